@@ -6,14 +6,25 @@ namespace esphome::ld2450
 
     static const char *TAG = "LD2450";
 
+    /// @brief Default names of targets without a configured name
+    static const char *const TARGET_NAMES[3] = {"Target 1", "Target 2", "Target 3"};
+
+    /// @brief Baud rates in probing order, most likely settings first
+    static const BaudRate AUTO_BAUD_CANDIDATES[] = {BAUD_256000, BAUD_460800, BAUD_115200, BAUD_230400, BAUD_57600, BAUD_38400, BAUD_19200, BAUD_9600};
+
+    /// @brief Commands which are part of multiple user actions
+    static const Command READ_TRACKING_MODE_COMMAND = {{COMMAND_READ_TRACKING_MODE, 0x00}, 2};
+    static const Command READ_MAC_COMMAND = {{COMMAND_READ_MAC, 0x00, 0x01, 0x00}, 4};
+    static const Command RESTART_COMMAND = {{COMMAND_RESTART, 0x00}, 2};
+
     void LD2450::setup()
     {
 
         // Fill target list with mock targets if not present
+        registered_target_count_ = targets_.size();
         for (int i = targets_.size(); i < 3; i++)
         {
-            Target *new_target = new Target();
-            targets_.push_back(new_target);
+            targets_.push_back(&mock_targets_[i]);
         }
 
         for (int i = 0; i < targets_.size(); i++)
@@ -21,15 +32,47 @@ namespace esphome::ld2450
             Target *target = targets_[i];
             // Generate Names if not present
             if (target->get_name() == nullptr)
-            {
-                std::string name = std::string("Target ").append(std::to_string(i + 1));
-                char *cstr = new char[name.length() + 1];
-                std::strcpy(cstr, name.c_str());
-                target->set_name(cstr);
-            }
+                target->set_name(TARGET_NAMES[i]);
 
             target->set_fast_off_detection(fast_off_detection_);
+            if (prediction_)
+                target->set_prediction(prediction_alpha_, prediction_beta_, max_coast_frames_, prediction_lookahead_);
+            if (has_pose_)
+                target->set_sensor_pose(std::clamp<int32_t>(pose_x_, INT16_MIN, INT16_MAX), std::clamp<int32_t>(pose_y_, INT16_MIN, INT16_MAX),
+                                        float(pose_cos_) / (1 << POSE_FRACTION_BITS), float(pose_sin_) / (1 << POSE_FRACTION_BITS));
+        }
+
+        // Collect derived target sensors which are published by the hub
+        for (Target *target : targets_)
+        {
+            target->get_sensors(polling_sensors_);
         }
+        for (PollingSensor *sensor : polling_sensors_)
+        {
+            sensor->setup_unit_conversion();
+        }
+        publish_tokens_ = max_publish_rate_;
+
+        // Restore persisted zones and build their geometry before the first frame is processed
+        for (Zone *zone : zones_)
+        {
+            zone->setup();
+        }
+        for (CrossingLine *line : crossing_lines_)
+        {
+            line->setup();
+        }
+
+        if (heatmap_ != nullptr)
+            heatmap_->setup();
+        if (trace_ != nullptr)
+            trace_->setup();
+        if (interference_mask_ != nullptr)
+            interference_mask_->setup();
+
+        // Transition counters are allocated once for all pairs of zones
+        if (zones_.size() > 1)
+            transitions_.assign(zones_.size() * zones_.size(), 0);
 
 #ifdef USE_BINARY_SENSOR
         if (occupancy_binary_sensor_ != nullptr)
@@ -43,8 +86,29 @@ namespace esphome::ld2450
             factory_reset_button_->add_on_press_callback([this]()
                                                          { this->perform_factory_reset(); });
 #endif
-        // Acquire current switch states and update related components
-        read_switch_states();
+#ifdef USE_ESP32
+        if (use_decode_task_)
+        {
+            // Decode on the core which is not running the main loop (if available)
+#if portNUM_PROCESSORS > 1
+            xTaskCreatePinnedToCore(decode_task, "ld2450_decode", DECODE_TASK_STACK_SIZE, this, DECODE_TASK_PRIORITY, &decode_task_handle_, 1 - xPortGetCoreID());
+#else
+            xTaskCreate(decode_task, "ld2450_decode", DECODE_TASK_STACK_SIZE, this, DECODE_TASK_PRIORITY, &decode_task_handle_);
+#endif
+            if (decode_task_handle_ == nullptr)
+                ESP_LOGW(TAG, "Creating the decode task failed, decoding within the main loop.");
+        }
+#endif
+
+        if (auto_baud_rate_)
+            known_baud_rate_ = parent_->get_baud_rate();
+
+        // Acquire current switch states and update related components, deferred until the sensor is streaming if requested
+        restore_settings();
+        if (fast_startup_)
+            startup_reads_pending_ = true;
+        else
+            run_startup_reads();
     }
 
     void LD2450::dump_config()
@@ -52,11 +116,25 @@ namespace esphome::ld2450
         ESP_LOGCONFIG(TAG, "LD2450 Hub: %s", name_);
         ESP_LOGCONFIG(TAG, "  fast_off_detection: %s", fast_off_detection_ ? "True" : "False");
         ESP_LOGCONFIG(TAG, "  flip_x_axis: %s", flip_x_axis_ ? "True" : "False");
+        if (has_pose_)
+            ESP_LOGCONFIG(TAG, "  mounting pose: (%i, %i) mm, rotation %.1f°", int(pose_x_), int(pose_y_), atan2(pose_sin_, pose_cos_) * 180 / M_PI);
         ESP_LOGCONFIG(TAG, "  max_detection_tilt_angle: %.2f °", max_detection_tilt_angle_);
         ESP_LOGCONFIG(TAG, "  min_detection_tilt_angle: %.2f °", min_detection_tilt_angle_);
         ESP_LOGCONFIG(TAG, "  max_detection_distance: %i mm", max_detection_distance_);
         ESP_LOGCONFIG(TAG, "  max_distance_margin: %i mm", max_distance_margin_);
         ESP_LOGCONFIG(TAG, "  tilt_angle_margin: %.2f °", tilt_angle_margin_);
+        ESP_LOGCONFIG(TAG, "  max_publish_rate: %u/s", max_publish_rate_);
+        ESP_LOGCONFIG(TAG, "  target_association: %s", target_association_ ? "True" : "False");
+        if (target_association_)
+            ESP_LOGCONFIG(TAG, "  association_gate: %i mm", association_gate_);
+#ifdef USE_ESP32
+        ESP_LOGCONFIG(TAG, "  decode_task: %s", decode_task_handle_ != nullptr ? "True" : "False");
+        ESP_LOGCONFIG(TAG, "  dropped_frames: %u", unsigned(dropped_frames_.load()));
+#endif
+        ESP_LOGCONFIG(TAG, "  collapsed_frames: %u", unsigned(collapsed_frames_));
+#ifdef USE_SENSOR
+        LOG_SENSOR("  ", "CollapsedFramesSensor", collapsed_frames_sensor_);
+#endif
 #ifdef USE_BINARY_SENSOR
         LOG_BINARY_SENSOR("  ", "OccupancyBinarySensor", occupancy_binary_sensor_);
 #endif
@@ -72,6 +150,10 @@ namespace esphome::ld2450
         LOG_SWITCH("  ", "TrackingModeSwitch", tracking_mode_switch_);
         LOG_SWITCH("  ", "BluetoothSwitch", bluetooth_switch_);
         LOG_SELECT("  ", "BaudRateSelect", baud_rate_select_);
+        for (int i = 0; i < registered_target_count_; i++)
+        {
+            targets_[i]->dump_config();
+        }
         ESP_LOGCONFIG(TAG, "Zones:");
         if (zones_.size() > 0)
         {
@@ -80,14 +162,149 @@ namespace esphome::ld2450
                 zone->dump_config();
             }
         }
+        for (ZoneGroup *zone_group : zone_groups_)
+        {
+            zone_group->dump_config();
+        }
+        for (CrossingLine *line : crossing_lines_)
+        {
+            line->dump_config();
+        }
+        if (heatmap_ != nullptr)
+            heatmap_->dump_config();
+        if (latency_monitor_ != nullptr)
+            latency_monitor_->dump_config();
+        if (trace_ != nullptr)
+            trace_->dump_config();
+        if (interference_mask_ != nullptr)
+            interference_mask_->dump_config();
+
+        ESP_LOGCONFIG(TAG, "  auto_baud_rate: %s", auto_baud_rate_ ? (upgrade_baud_rate_ ? "True (upgrade to 460800)" : "True") : "False");
+        ESP_LOGCONFIG(TAG, "  fast_startup: %s", fast_startup_ ? "True" : "False");
+        ESP_LOGCONFIG(TAG, "  cache_settings: %s", cache_settings_ ? "True" : "False");
+#ifdef USE_SENSOR
+        LOG_SENSOR("  ", "TimeToFirstOccupancySensor", time_to_first_occupancy_sensor_);
+#endif
 
-        // Read and log Firmware-version
-        log_sensor_version();
-        log_bluetooth_mac();
+        // Firmware version and MAC address are requested during startup, only log known values here
+        if (settings_.has_firmware)
+            ESP_LOGCONFIG(TAG, "  firmware version: V%X.%02X.%02X%02X%02X%02X", settings_.firmware[0], settings_.firmware[1], settings_.firmware[2], settings_.firmware[3], settings_.firmware[4], settings_.firmware[5]);
+        if (settings_.bluetooth == 1)
+            ESP_LOGCONFIG(TAG, "  MAC address: %02X:%02X:%02X:%02X:%02X:%02X", settings_.mac[0], settings_.mac[1], settings_.mac[2], settings_.mac[3], settings_.mac[4], settings_.mac[5]);
+    }
+
+    void LD2450::update_auto_baud()
+    {
+        if (!auto_baud_rate_ || is_applying_changes_)
+            return;
+
+        if (!baud_probing_)
+        {
+            // Move a communicating sensor to the highest baud rate once, the UART follows after the restart
+            if (sensor_available_)
+            {
+                if (upgrade_baud_rate_ && !baud_rate_upgrade_requested_ && known_baud_rate_ != baud_rate_to_int(BAUD_460800))
+                {
+                    baud_rate_upgrade_requested_ = true;
+                    ESP_LOGI(TAG, "Upgrading sensor baud rate from %u to 460800.", unsigned(known_baud_rate_));
+                    set_baud_rate(BAUD_460800);
+                }
+                return;
+            }
+
+            // Start probing once no valid message was received for a while, retry unsuccessful cycles after a longer pause
+            if (millis() - last_message_received_ <= SENSOR_UNAVAILABLE_TIMEOUT || !command_queue_.empty() ||
+                (last_probe_cycle_ != 0 && millis() - last_probe_cycle_ < AUTO_BAUD_RETRY_INTERVAL))
+                return;
+
+            ESP_LOGW(TAG, "No valid messages received at %u baud, probing baud rates.", unsigned(known_baud_rate_));
+            baud_probing_ = true;
+            probe_index_ = 0;
+        }
+        else if (millis() - probe_started_ < AUTO_BAUD_PROBE_TIME)
+        {
+            return;
+        }
+        else
+        {
+            probe_index_++;
+        }
+
+        // The known baud rate has already failed and is skipped
+        size_t candidate_count = sizeof(AUTO_BAUD_CANDIDATES) / sizeof(AUTO_BAUD_CANDIDATES[0]);
+        if (probe_index_ < candidate_count && baud_rate_to_int(AUTO_BAUD_CANDIDATES[probe_index_]) == known_baud_rate_)
+            probe_index_++;
+
+        if (probe_index_ >= candidate_count)
+        {
+            ESP_LOGW(TAG, "No valid messages received at any baud rate, restoring %u baud.", unsigned(known_baud_rate_));
+            baud_probing_ = false;
+            last_probe_cycle_ = std::max<uint32_t>(millis(), 1);
+            set_uart_baud_rate(known_baud_rate_);
+            return;
+        }
+
+        ESP_LOGD(TAG, "Probing %u baud.", unsigned(baud_rate_to_int(AUTO_BAUD_CANDIDATES[probe_index_])));
+        set_uart_baud_rate(baud_rate_to_int(AUTO_BAUD_CANDIDATES[probe_index_]));
+        probe_started_ = millis();
+    }
+
+    void LD2450::set_uart_baud_rate(uint32_t baud_rate)
+    {
+        parent_->set_baud_rate(baud_rate);
+        parent_->load_settings(false);
+
+        // Bytes received at the previous baud rate are garbage, restart parsing
+        while (available())
+        {
+            read();
+        }
+        peek_status_ = 0;
+        configuration_message_length_ = 0;
+    }
+
+    void LD2450::restore_settings()
+    {
+        if (!cache_settings_)
+            return;
+
+        // Several sensors share the default name, hence the key is derived from the id of the component
+        settings_pref_ = global_preferences->make_preference<SensorSettings>(fnv1_hash(std::string("LD2450 settings ") + (component_id_ != nullptr ? component_id_ : name_)));
+        SensorSettings settings;
+        if (!settings_pref_.load(&settings) || settings.version != SENSOR_SETTINGS_VERSION)
+            return;
+        settings_ = settings;
+
+        if (tracking_mode_switch_ != nullptr && settings_.tracking_mode != SETTING_UNKNOWN)
+            tracking_mode_switch_->publish_state(settings_.tracking_mode == 1);
+        if (bluetooth_switch_ != nullptr && settings_.bluetooth != SETTING_UNKNOWN)
+            bluetooth_switch_->publish_state(settings_.bluetooth == 1);
+    }
+
+    void LD2450::run_startup_reads()
+    {
+        startup_reads_pending_ = false;
+
+        // Each request is queued into the same config session, settings restored from the cache are skipped
+        if (settings_.tracking_mode == SETTING_UNKNOWN)
+            send_config_messages(&READ_TRACKING_MODE_COMMAND, 1, "tracking mode read");
+        if (settings_.bluetooth == SETTING_UNKNOWN)
+            log_bluetooth_mac();
+        if (!settings_.has_firmware)
+            log_sensor_version();
+    }
+
+    void LD2450::save_settings()
+    {
+        if (cache_settings_)
+            settings_pref_.save(&settings_);
     }
 
     const uint8_t update_header[4] = {0xAA, 0xFF, 0x03, 0x00};
     const uint8_t config_header[4] = {0xFD, 0xFC, 0xFB, 0xFA};
+    const uint8_t config_end[4] = {0x04, 0x03, 0x02, 0x01};
+    const uint8_t enter_config[4] = {COMMAND_ENTER_CONFIG, 0x00, 0x01, 0x00};
+    const uint8_t leave_config[2] = {COMMAND_LEAVE_CONFIG, 0x00};
     void LD2450::loop()
     {
         // Only process commands if the sensor is not currently restarting / applying changes
@@ -96,12 +313,12 @@ namespace esphome::ld2450
             is_applying_changes_ = false;
 
             // Process command queue
-            if (command_queue_.size() > 0)
+            if (!command_queue_.empty())
             {
                 // Inject enter config mode command if not in mode
-                if (!configuration_mode_ && command_queue_.front()[0] != COMMAND_ENTER_CONFIG)
+                if (!configuration_mode_ && command_queue_.front_word() != COMMAND_ENTER_CONFIG)
                 {
-                    command_queue_.insert(command_queue_.begin(), {COMMAND_ENTER_CONFIG, 0x00, 0x01, 0x00});
+                    command_queue_.push_front(enter_config, sizeof(enter_config));
                 }
 
                 // Wait before retransmitting
@@ -111,13 +328,13 @@ namespace esphome::ld2450
                     // Remove command form queue after max retries
                     if (command_send_retries_ >= COMMAND_MAX_RETRIES)
                     {
-                        if (command_queue_.front()[0] == COMMAND_LEAVE_CONFIG)
+                        if (command_queue_.front_word() == COMMAND_LEAVE_CONFIG)
                         {
                             // Leave config mode to prevent re-adding the command to the queue (assume config mode already exited)
                             configuration_mode_ = false;
-                            command_queue_.erase(command_queue_.begin());
+                            command_queue_.pop_front();
                         }
-                        else if (command_queue_.front()[0] == COMMAND_ENTER_CONFIG)
+                        else if (command_queue_.front_word() == COMMAND_ENTER_CONFIG)
                         {
                             // Clear command queue in case entering config mode failed
                             command_queue_.clear();
@@ -125,15 +342,15 @@ namespace esphome::ld2450
                         }
                         else
                         {
-                            command_queue_.erase(command_queue_.begin());
+                            command_queue_.pop_front();
                         }
                         command_send_retries_ = 0;
                         ESP_LOGW(TAG, "Sending command timed out! Is the sensor connected?");
                     }
                     else
                     {
-                        std::vector<uint8_t> command = command_queue_.front();
-                        write_command(&command[0], command.size());
+                        const Command &command = command_queue_.front();
+                        write_command(command.data, command.length);
                         command_last_sent_ = millis();
                         command_send_retries_++;
                     }
@@ -142,97 +359,68 @@ namespace esphome::ld2450
             else if (configuration_mode_)
             {
                 // Inject leave config command after clearing the queue
-                command_queue_.push_back({COMMAND_LEAVE_CONFIG, 0x00});
+                command_queue_.push_back(leave_config, sizeof(leave_config));
                 command_send_retries_ = 0;
             }
         }
 
-        // Try to process as many messages as possible in a single iteration
-        bool processed_message = false;
-        do
+        // Drain available messages within the time/work budget. Positional data is last-writer-wins, hence a backlog of
+        // data messages is collapsed to the newest one and only that one is processed. Config messages keep their
+        // position within the stream, as processing a data message leaves the config mode.
+        uint32_t budget_start = millis();
+        int frames_read = 0;
+        bool has_data_frame = false;
+        Frame data_frame;
+        Frame frame;
+        while (frames_read < LOOP_FRAME_BUDGET && millis() - budget_start <= LOOP_TIME_BUDGET && next_frame(frame))
         {
-            processed_message = false;
-
-            // Skip stream until start of message and parse header
-            while (!peek_status_ && available() >= 4)
+            frames_read++;
+            if (frame.type == FRAME_DATA)
             {
-                // Try to read the header and abort on mismatch
-                const uint8_t *header;
-                uint8_t message_type;
-                uint8_t first_byte = read();
-                if (first_byte == update_header[0])
-                {
-                    header = update_header;
-                    message_type = 1;
-                }
-                else if (first_byte == config_header[0])
-                {
-                    header = config_header;
-                    message_type = 2;
-                }
-                else
-                {
-                    continue;
-                }
-
-                bool header_match = true;
-                for (int i = 1; i < 4; i++)
-                {
-                    if (read() != header[i])
-                    {
-                        header_match = false;
-                        break;
-                    }
-                }
-
-                if (header_match)
-                    // Flag successful header reading
-                    peek_status_ = message_type;
+                if (has_data_frame)
+                    collapsed_frames_++;
+                data_frame = frame;
+                has_data_frame = true;
             }
-
-            if (peek_status_ == 1 && available() >= 26)
+            else
             {
-                uint8_t msg[26] = {0x00};
-                read_array(msg, 26);
-                peek_status_ = 0;
+                if (has_data_frame)
+                    apply_frame(data_frame);
+                has_data_frame = false;
+                apply_frame(frame);
+            }
+        }
+        if (has_data_frame)
+            apply_frame(data_frame);
 
-                // Skip invalid messages
-                if (msg[24] != 0x55 || msg[25] != 0xCC)
-                    return;
+#ifdef USE_ESP32
+        if (decode_task_handle_ == nullptr)
+#endif
+            check_rx_buffer();
 
-                process_message(msg, 24);
-                processed_message = true;
-            }
-            if (peek_status_ == 2 && (available() >= 2 || configuration_message_length_ > 0))
-            {
-                if (configuration_message_length_ == 0)
-                {
-                    // Read message content length
-                    uint8_t content_length[2];
-                    read_array(content_length, 2);
-                    configuration_message_length_ = content_length[1] << 8 | content_length[0];
-                    // Limit max message length
-                    configuration_message_length_ = std::min(configuration_message_length_, 20);
-                }
+        // Publish derived target sensors
+        if (millis() - last_publish_schedule_ >= PUBLISH_SCHEDULER_INTERVAL)
+            schedule_publishes();
 
-                // Wait until message and frame end are available
-                if (available() >= configuration_message_length_ + 4)
-                {
-                    uint8_t msg[configuration_message_length_ + 4] = {0x00};
-                    read_array(msg, configuration_message_length_ + 4);
+        // Publish instrumentation values periodically
+        if (millis() - last_statistics_update_ > STATISTICS_INTERVAL)
+        {
+            last_statistics_update_ = millis();
+            publish_statistics();
 
-                    // Assert frame end read correctly
-                    if (msg[configuration_message_length_] == 0x04 && msg[configuration_message_length_ + 1] == 0x03 && msg[configuration_message_length_ + 2] == 0x02 && msg[configuration_message_length_ + 3] == 0x01)
-                    {
-                        process_config_message(msg, configuration_message_length_);
-                    }
-                    configuration_message_length_ = 0;
-                    peek_status_ = 0;
-                    processed_message = true;
-                }
+            // Persist line counters (wear-limited by the save interval of each line)
+            for (CrossingLine *line : crossing_lines_)
+            {
+                line->save();
             }
+        }
 
-        } while (processed_message);
+        // Publish low-rate zone aggregates
+        if (millis() - last_zone_statistics_update_ > zone_statistics_interval_)
+        {
+            last_zone_statistics_update_ = millis();
+            publish_zone_statistics();
+        }
 
         // Detect missing updates from the sensor (not connect or in configuration mode)
         if (sensor_available_ && millis() - last_message_received_ > SENSOR_UNAVAILABLE_TIMEOUT)
@@ -241,40 +429,149 @@ namespace esphome::ld2450
 
             ESP_LOGE(TAG, "LD2450-Sensor stopped sending updates!");
 
-#ifdef USE_BINARY_SENSOR
-            if (occupancy_binary_sensor_ != nullptr)
-                occupancy_binary_sensor_->publish_state(false);
-#endif
-#ifdef USE_SENSOR
-            if (target_count_sensor_ != nullptr)
-                target_count_sensor_->publish_state(NAN);
-#endif
-
-            // Update zones and related components (unavailable)
-            for (Zone *zone : zones_)
-            {
-                zone->update(targets_, sensor_available_);
-            }
-
             // Update targets and related components (unavailable)
             for (Target *target : targets_)
             {
                 target->clear();
             }
+
+            // Update zones and related components (unavailable), the snapshot no longer reports the cleared targets
+            is_occupied_ = false;
+            for (Zone *zone : zones_)
+            {
+                zone->update(targets_, sensor_available_, millis());
+            }
+            commit_state(STATE_UNAVAILABLE);
+            publish_snapshot();
         }
 
+        update_auto_baud();
+
         // Assume the sensor is in it's configuration mode, attempt to leave
         // Attempt to leave config mode periodically if the sensor is not sending updates
-        if (!is_applying_changes_ && !sensor_available_ && millis() - last_config_leave_attempt_ > CONFIG_RECOVERY_INTERVAL)
+        if (!is_applying_changes_ && !baud_probing_ && !sensor_available_ && millis() - last_config_leave_attempt_ > CONFIG_RECOVERY_INTERVAL)
         {
             ESP_LOGD(TAG, "Sensor is not sending updates, attempting to leave config mode.");
             last_config_leave_attempt_ = millis();
             command_send_retries_ = 0;
             configuration_mode_ = true;
             command_queue_.clear();
-            command_queue_.push_back({COMMAND_LEAVE_CONFIG, 0x00});
+            command_queue_.push_back(leave_config, sizeof(leave_config));
         }
+    }
 
+    bool LD2450::next_frame(Frame &frame)
+    {
+#ifdef USE_ESP32
+        if (decode_task_handle_ != nullptr)
+            return frame_queue_.pop(frame);
+#endif
+        while (read_frame(frame))
+        {
+            if (frame.type != FRAME_NONE)
+                return true;
+        }
+        return false;
+    }
+
+    bool LD2450::read_frame(Frame &frame)
+    {
+        frame.type = FRAME_NONE;
+
+        // Skip stream until start of message and parse header
+        while (!peek_status_ && available() >= 4)
+        {
+            // Try to read the header and abort on mismatch
+            const uint8_t *header;
+            uint8_t message_type;
+            uint8_t first_byte = read();
+            if (first_byte == update_header[0])
+            {
+                header = update_header;
+                message_type = 1;
+            }
+            else if (first_byte == config_header[0])
+            {
+                header = config_header;
+                message_type = 2;
+            }
+            else
+            {
+                continue;
+            }
+
+            bool header_match = true;
+            for (int i = 1; i < 4; i++)
+            {
+                if (read() != header[i])
+                {
+                    header_match = false;
+                    break;
+                }
+            }
+
+            if (header_match)
+            {
+                // Flag successful header reading
+                peek_status_ = message_type;
+                frame_timestamp_ = millis();
+                frame_arrival_ = micros();
+            }
+        }
+
+        if (peek_status_ == 1 && available() >= 26)
+        {
+            uint8_t msg[26] = {0x00};
+            read_array(msg, 26);
+            peek_status_ = 0;
+
+            // Skip invalid messages
+            if (msg[24] != 0x55 || msg[25] != 0xCC)
+                return true;
+
+            frame.type = FRAME_DATA;
+            frame.timestamp = frame_timestamp_;
+            frame.arrival = frame_arrival_;
+            decode_targets(msg, frame);
+            return true;
+        }
+        if (peek_status_ == 2 && (available() >= 2 || configuration_message_length_ > 0))
+        {
+            if (configuration_message_length_ == 0)
+            {
+                // Read message content length
+                uint8_t content_length[2];
+                read_array(content_length, 2);
+                configuration_message_length_ = content_length[1] << 8 | content_length[0];
+                // Limit max message length
+                configuration_message_length_ = std::min(configuration_message_length_, CONFIG_MESSAGE_MAX_LENGTH);
+            }
+
+            // Wait until message and frame end are available
+            if (available() >= configuration_message_length_ + 4)
+            {
+                uint8_t msg[CONFIG_MESSAGE_MAX_LENGTH + 4] = {0x00};
+                read_array(msg, configuration_message_length_ + 4);
+
+                // Assert frame end read correctly
+                if (msg[configuration_message_length_] == 0x04 && msg[configuration_message_length_ + 1] == 0x03 && msg[configuration_message_length_ + 2] == 0x02 && msg[configuration_message_length_ + 3] == 0x01)
+                {
+                    frame.type = FRAME_CONFIG;
+                    frame.timestamp = frame_timestamp_;
+                    frame.arrival = frame_arrival_;
+                    frame.config_length = configuration_message_length_;
+                    memcpy(frame.config, msg, configuration_message_length_);
+                }
+                configuration_message_length_ = 0;
+                peek_status_ = 0;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void LD2450::check_rx_buffer()
+    {
         if (available() != last_available_size_)
         {
             last_available_size_ = available();
@@ -293,12 +590,150 @@ namespace esphome::ld2450
         }
     }
 
-    void LD2450::process_message(uint8_t *msg, int len)
+#ifdef USE_ESP32
+    void LD2450::decode_task(void *param)
     {
-        sensor_available_ = true;
-        last_message_received_ = millis();
-        configuration_mode_ = false;
+        LD2450 *hub = static_cast<LD2450 *>(param);
+        Frame frame;
+        while (true)
+        {
+            while (hub->read_frame(frame))
+            {
+                if (frame.type != FRAME_NONE && !hub->frame_queue_.push(frame))
+                    hub->dropped_frames_++;
+            }
+            hub->check_rx_buffer();
+            vTaskDelay(pdMS_TO_TICKS(DECODE_TASK_INTERVAL));
+        }
+    }
+#endif
+
+    void LD2450::schedule_publishes()
+    {
+        uint32_t now = millis();
+        if (max_publish_rate_ != 0)
+        {
+            // Refill the token bucket, allowing bursts of up to one second worth of publishes
+            publish_tokens_ = std::min(publish_tokens_ + (now - last_publish_schedule_) * max_publish_rate_ / 1000.0f, float(max_publish_rate_));
+        }
+        last_publish_schedule_ = now;
 
+        // Check sensors round-robin, such that sensors at the end of the list are not starved by a small budget
+        size_t count = polling_sensors_.size();
+        size_t next_cursor = publish_cursor_;
+        for (size_t i = 0; i < count; i++)
+        {
+            if (max_publish_rate_ != 0 && publish_tokens_ < 1)
+                break;
+
+            size_t index = (publish_cursor_ + i) % count;
+            PollingSensor *sensor = polling_sensors_[index];
+            if (sensor->is_due(now))
+            {
+                sensor->publish(now);
+                publish_tokens_ -= 1;
+                next_cursor = index + 1;
+            }
+        }
+        publish_cursor_ = count > 0 ? next_cursor % count : 0;
+    }
+
+    void LD2450::publish_statistics()
+    {
+        ESP_LOGV(TAG, "Collapsed frames: %u, dropped frames: %u", unsigned(collapsed_frames_), unsigned(dropped_frames_.load()));
+        ESP_LOGV(TAG, "Publish calls: %u, suppressed publishes: %u", unsigned(publish_calls_), unsigned(suppressed_publishes_));
+#ifdef USE_SENSOR
+        if (collapsed_frames_sensor_ != nullptr && collapsed_frames_sensor_->raw_state != collapsed_frames_)
+            collapsed_frames_sensor_->publish_state(collapsed_frames_);
+#endif
+        if (latency_monitor_ != nullptr)
+            latency_monitor_->publish_statistics();
+    }
+
+    void LD2450::update_transitions()
+    {
+        if (transitions_.empty())
+            return;
+
+        size_t zone_count = zones_.size();
+        for (size_t i = 0; i < 3; i++)
+        {
+            // Overlapping zones are resolved by the order of the zone list
+            int8_t zone = -1;
+            for (size_t j = 0; j < zone_count && zone == -1; j++)
+            {
+                if (zones_[j]->is_tracking(i))
+                    zone = j;
+            }
+
+            if (zone == -1)
+            {
+                // Targets which are lost lose their zone history, as the identity of the target is unknown afterwards
+                if (!targets_[i]->has_position())
+                    last_zone_[i] = -1;
+                continue;
+            }
+
+            if (last_zone_[i] != -1 && last_zone_[i] != zone)
+                transitions_[last_zone_[i] * zone_count + zone]++;
+            last_zone_[i] = zone;
+        }
+    }
+
+    void LD2450::publish_zone_statistics()
+    {
+        for (Zone *zone : zones_)
+        {
+            zone->publish_statistics();
+        }
+#ifdef USE_SENSOR
+        for (const TransitionSensor &transition : transition_sensors_)
+        {
+            transition.sensor->publish_state(get_transition_count(transition.from, transition.to));
+        }
+#endif
+
+        if (transitions_.empty())
+            return;
+        size_t zone_count = zones_.size();
+        ESP_LOGD(TAG, "Zone transitions (row: from, column: to):");
+        for (size_t i = 0; i < zone_count; i++)
+        {
+            char row[128];
+            size_t length = 0;
+            for (size_t j = 0; j < zone_count && length < sizeof(row); j++)
+                length += snprintf(row + length, sizeof(row) - length, " %6u", unsigned(transitions_[i * zone_count + j]));
+            ESP_LOGD(TAG, "  %-16s%s", zones_[i]->get_name(), row);
+        }
+    }
+
+    void LD2450::apply_frame(const Frame &frame)
+    {
+        // Header and tail of the message matched, hence the probed baud rate is correct
+        if (baud_probing_ && frame.type != FRAME_NONE)
+        {
+            baud_probing_ = false;
+            known_baud_rate_ = parent_->get_baud_rate();
+            ESP_LOGI(TAG, "Detected sensor baud rate: %u", unsigned(known_baud_rate_));
+            if (baud_rate_select_ != nullptr)
+            {
+                // Publish the option string of the select instead of formatting a temporary string
+                for (const auto &option : BAUD_STRING_TO_ENUM)
+                {
+                    if (baud_rate_to_int(option.second) == known_baud_rate_)
+                        baud_rate_select_->publish_state(option.first);
+                }
+            }
+        }
+
+        if (frame.type == FRAME_DATA)
+            process_message(frame);
+        else if (frame.type == FRAME_CONFIG)
+            process_config_message(frame.config, frame.config_length);
+    }
+
+    void LD2450::decode_targets(const uint8_t *msg, Frame &frame)
+    {
         for (int i = 0; i < 3; i++)
         {
             int offset = 8 * i;
@@ -314,55 +749,266 @@ namespace esphome::ld2450
                 speed = -speed + 0x8000;
             int distance_resolution = msg[offset + 7] << 8 | msg[offset + 6];
 
+            frame.targets[i].x = x;
+            frame.targets[i].y = y;
+            frame.targets[i].speed = speed;
+            frame.targets[i].resolution = distance_resolution;
+        }
+    }
+
+    void LD2450::on_shutdown()
+    {
+        for (CrossingLine *line : crossing_lines_)
+        {
+            line->save(true);
+        }
+    }
+
+    void LD2450::process_message(const Frame &frame)
+    {
+        uint32_t processing_start = micros();
+        sensor_available_ = true;
+        last_message_received_ = millis();
+        configuration_mode_ = false;
+        last_frame_timestamp_ = frame.timestamp;
+
+        // Readings in sensor coordinates are used for gating, all other stages use room coordinates
+        TargetReading sensor_readings[3];
+        TargetReading readings[3];
+        for (int i = 0; i < 3; i++)
+        {
+            sensor_readings[i] = frame.targets[i];
+
             // Flip x axis if required
-            x = x * (flip_x_axis_ ? -1 : 1);
+            sensor_readings[i].x = sensor_readings[i].x * (flip_x_axis_ ? -1 : 1);
+
+            readings[i] = sensor_readings[i];
+            if (has_pose_ && readings[i].resolution != 0)
+                apply_mounting_pose(readings[i]);
+        }
+
+        // Determine which target is updated by which slot of the message
+        uint8_t assignment[3] = {0, 1, 2};
+        if (target_association_)
+            associate_targets(readings, assignment);
+
+        for (int i = 0; i < 3; i++)
+        {
+            Target *target = targets_[assignment[i]];
+            int16_t x = readings[i].x;
+            int16_t y = readings[i].y;
+            int16_t speed = readings[i].speed;
+            int16_t distance_resolution = readings[i].resolution;
+
+            // Trace raw measurements of debugged targets, including the first empty slot after the target vanished
+            if (trace_ != nullptr && target->is_debugging() && (distance_resolution != 0 || target->get_distance_resolution() != 0))
+                trace_->record(frame_sequence_, i, assignment[i], x, y, speed, distance_resolution);
+
+            // Discard ghost targets in masked areas before they reach the target and zones
+            if (interference_mask_ != nullptr)
+            {
+                interference_mask_->observe(assignment[i], x, y, speed, distance_resolution, frame.timestamp);
+                if (distance_resolution != 0 && interference_mask_->contains(x, y))
+                {
+                    target->clear();
+                    continue;
+                }
+            }
 
-            // Filter targets further than max detection distance and max angle
-            float angle = -(atan2(y, x) * (180 / M_PI) - 90);
-            if ((y <= max_detection_distance_ || (targets_[i]->is_present() && y <= max_detection_distance_ + max_distance_margin_)) &&
-                (angle <= max_detection_tilt_angle_ || (targets_[i]->is_present() && angle <= max_detection_tilt_angle_ + tilt_angle_margin_)) &&
-                (angle >= min_detection_tilt_angle_ || (targets_[i]->is_present() && angle >= min_detection_tilt_angle_ - tilt_angle_margin_)))
+            // Filter targets further than max detection distance and max angle (relative to the sensor)
+            int16_t sensor_x = sensor_readings[i].x;
+            int16_t sensor_y = sensor_readings[i].y;
+            float angle = -(atan2(sensor_y, sensor_x) * (180 / M_PI) - 90);
+            bool located = target->has_position();
+            if ((sensor_y <= max_detection_distance_ || (located && sensor_y <= max_detection_distance_ + max_distance_margin_)) &&
+                (angle <= max_detection_tilt_angle_ || (located && angle <= max_detection_tilt_angle_ + tilt_angle_margin_)) &&
+                (angle >= min_detection_tilt_angle_ || (located && angle >= min_detection_tilt_angle_ - tilt_angle_margin_)))
             {
-                targets_[i]->update_values(x, y, speed, distance_resolution);
+                target->update_values(x, y, speed, distance_resolution, frame.timestamp);
+                for (CrossingLine *line : crossing_lines_)
+                {
+                    line->update(target);
+                }
             }
-            else if (y > max_detection_distance_ + max_distance_margin_ ||
+            else if (sensor_y > max_detection_distance_ + max_distance_margin_ ||
                      angle > max_detection_tilt_angle_ + tilt_angle_margin_ ||
                      angle < min_detection_tilt_angle_ - tilt_angle_margin_)
             {
-                targets_[i]->clear();
+                target->clear();
             }
         }
 
+        // Compute the new state of the hub and all zones
         int target_count = 0;
         for (Target *target : targets_)
         {
-            target_count += target->is_present();
+            // Predicted targets bridge short dropouts of the sensor, but are not accounted in the heatmap
+            target_count += target->has_position();
+            if (heatmap_ != nullptr)
+                heatmap_->update(target);
         }
         is_occupied_ = target_count > 0;
+        frame_sequence_++;
+        publish_snapshot();
+
+        for (Zone *zone : zones_)
+        {
+            zone->update(targets_, sensor_available_, frame.timestamp);
+        }
+        update_transitions();
+        uint32_t processing_end = micros();
+
+        // Publish changed entities
+        commit_state(target_count);
+        if (latency_monitor_ != nullptr)
+            latency_monitor_->record(frame.arrival, processing_start, processing_end, micros());
+
+        if (!first_frame_processed_)
+        {
+            first_frame_processed_ = true;
+            uint32_t time_to_first_occupancy = millis();
+            ESP_LOGI(TAG, "First occupancy state available %u ms after boot.", unsigned(time_to_first_occupancy));
+#ifdef USE_SENSOR
+            if (time_to_first_occupancy_sensor_ != nullptr)
+                time_to_first_occupancy_sensor_->publish_state(time_to_first_occupancy);
+#endif
+        }
+
+        // The sensor is streaming, config reads no longer delay the first occupancy state
+        if (startup_reads_pending_)
+            run_startup_reads();
+    }
+
+    void LD2450::commit_state(int target_count)
+    {
+        int publishes = 0;
+        int unchanged = 0;
 
 #ifdef USE_BINARY_SENSOR
         if (occupancy_binary_sensor_ != nullptr)
-            occupancy_binary_sensor_->publish_state(is_occupied_);
+        {
+            if (committed_target_count_ == STATE_UNKNOWN || (committed_target_count_ > 0) != (target_count > 0))
+            {
+                occupancy_binary_sensor_->publish_state(target_count > 0);
+                publishes++;
+            }
+            else
+            {
+                unchanged++;
+            }
+        }
 #endif
 #ifdef USE_SENSOR
-        if (target_count_sensor_ != nullptr && target_count_sensor_->raw_state != target_count)
-            target_count_sensor_->publish_state(target_count);
+        if (target_count_sensor_ != nullptr)
+        {
+            if (committed_target_count_ != target_count)
+            {
+                target_count_sensor_->publish_state(target_count == STATE_UNAVAILABLE ? NAN : target_count);
+                publishes++;
+            }
+            else
+            {
+                unchanged++;
+            }
+        }
 #endif
+        committed_target_count_ = target_count;
 
-        // Update zones and related components
-        for (Zone *zone : zones_)
+        // Zone groups are derived from a single bitmask of occupied zones
+        uint32_t occupied_mask = 0;
+        for (size_t i = 0; i < zones_.size(); i++)
+        {
+            zones_[i]->commit(publishes, unchanged);
+            if (i < MAX_GROUPED_ZONES && zones_[i]->is_occupied())
+                occupied_mask |= uint32_t(1) << i;
+        }
+        for (CrossingLine *line : crossing_lines_)
+        {
+            line->commit(publishes, unchanged);
+        }
+        for (ZoneGroup *zone_group : zone_groups_)
+        {
+            zone_group->commit(occupied_mask, target_count != STATE_UNAVAILABLE, publishes, unchanged);
+        }
+
+        publish_calls_ += publishes;
+        suppressed_publishes_ += unchanged;
+        consume_publish_budget(publishes);
+    }
+
+    void LD2450::publish_snapshot()
+    {
+        FrameSnapshot snapshot{};
+        snapshot.sequence = frame_sequence_;
+        snapshot.timestamp = last_frame_timestamp_;
+        snapshot.sensor_available = sensor_available_;
+        for (int i = 0; i < 3; i++)
         {
-            zone->update(targets_, sensor_available_);
+            Target *target = targets_[i];
+            bool present = target->is_present();
+            bool predicted = target->is_predicted();
+            snapshot.targets[i] = {target->get_x(), target->get_y(), target->get_speed(), target->get_distance_resolution(), present, predicted};
+            snapshot.target_count += present || predicted;
         }
+        snapshot.occupied = snapshot.target_count > 0;
+        snapshot_.write(snapshot);
     }
 
-    void LD2450::process_config_message(uint8_t *msg, int len)
+    void LD2450::associate_targets(const TargetReading *readings, uint8_t *assignment)
+    {
+        // All possible assignments of 3 message slots to 3 targets, identity first to keep the slot order on ties
+        static const uint8_t PERMUTATIONS[6][3] = {{0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}};
+
+        // Build the cost matrix, pairs outside of the gate are only used if no other choice is left
+        int32_t gate_squared = int32_t(association_gate_) * association_gate_;
+        int32_t cost[3][3];
+        for (int i = 0; i < 3; i++)
+        {
+            bool detected = readings[i].resolution != 0;
+            for (int j = 0; j < 3; j++)
+            {
+                bool present = targets_[j]->has_position();
+                if (detected && present)
+                {
+                    int32_t dx = readings[i].x - targets_[j]->get_x();
+                    int32_t dy = readings[i].y - targets_[j]->get_y();
+                    int32_t distance_squared = dx * dx + dy * dy;
+                    cost[i][j] = distance_squared <= gate_squared ? distance_squared : 2 * gate_squared + 1;
+                }
+                else if (detected || present)
+                {
+                    // New target or lost target
+                    cost[i][j] = gate_squared;
+                }
+                else
+                {
+                    cost[i][j] = 0;
+                }
+            }
+        }
+
+        int best = 0;
+        int32_t best_cost = INT32_MAX;
+        for (int p = 0; p < 6; p++)
+        {
+            int32_t total = cost[0][PERMUTATIONS[p][0]] + cost[1][PERMUTATIONS[p][1]] + cost[2][PERMUTATIONS[p][2]];
+            if (total < best_cost)
+            {
+                best_cost = total;
+                best = p;
+            }
+        }
+
+        for (int i = 0; i < 3; i++)
+            assignment[i] = PERMUTATIONS[best][i];
+    }
+
+    void LD2450::process_config_message(const uint8_t *msg, int len)
     {
         // Remove command from Queue upon receiving acknowledgement
-        std::vector<uint8_t> command = command_queue_.front();
-        if (command_queue_.size() > 0 && command[0] == msg[0] && msg[1] == 0x01)
+        if (!command_queue_.empty() && command_queue_.front_word() == msg[0] && msg[1] == 0x01)
         {
-            command_queue_.erase(command_queue_.begin());
+            command_queue_.pop_front();
             command_send_retries_ = 0;
             command_last_sent_ = 0;
         }
@@ -377,10 +1023,27 @@ namespace esphome::ld2450
             configuration_mode_ = false;
         }
 
+        if (msg[0] == COMMAND_SET_BAUD_RATE && msg[1] == true && auto_baud_rate_)
+        {
+            // The sensor applies the new baud rate after its next restart
+            pending_baud_rate_ = baud_rate_to_int(requested_baud_rate_);
+        }
+
         if ((msg[0] == COMMAND_FACTORY_RESET || msg[0] == COMMAND_RESTART) && msg[1] == true)
         {
             configuration_mode_ = false;
 
+            // Follow the sensor to its new baud rate (factory resets restore the default baud rate)
+            if (auto_baud_rate_ && msg[0] == COMMAND_FACTORY_RESET)
+                pending_baud_rate_ = baud_rate_to_int(BAUD_256000);
+            if (auto_baud_rate_ && msg[0] == COMMAND_RESTART && pending_baud_rate_ != 0)
+            {
+                ESP_LOGI(TAG, "Switching UART to %u baud.", unsigned(pending_baud_rate_));
+                known_baud_rate_ = pending_baud_rate_;
+                pending_baud_rate_ = 0;
+                set_uart_baud_rate(known_baud_rate_);
+            }
+
             // Wait for sensor to restart and apply configuration before requesting switch states
             is_applying_changes_ = true;
             apply_change_lockout_ = millis();
@@ -389,6 +1052,14 @@ namespace esphome::ld2450
         if (msg[0] == COMMAND_READ_VERSION && msg[1] == true)
         {
             ESP_LOGI(TAG, "Sensor Firmware-Version: V%X.%02X.%02X%02X%02X%02X", msg[7], msg[6], msg[11], msg[10], msg[9], msg[8]);
+
+            const uint8_t firmware[6] = {msg[7], msg[6], msg[11], msg[10], msg[9], msg[8]};
+            if (!settings_.has_firmware || memcmp(settings_.firmware, firmware, sizeof(firmware)) != 0)
+            {
+                settings_.has_firmware = true;
+                memcpy(settings_.firmware, firmware, sizeof(firmware));
+                save_settings();
+            }
         }
 
         if (msg[0] == COMMAND_READ_MAC && msg[1] == true)
@@ -408,6 +1079,13 @@ namespace esphome::ld2450
             {
                 ESP_LOGI(TAG, "Sensor MAC-Address: Bluetooth disabled!");
             }
+
+            if (settings_.bluetooth != bt_enabled || memcmp(settings_.mac, &msg[4], sizeof(settings_.mac)) != 0)
+            {
+                settings_.bluetooth = bt_enabled;
+                memcpy(settings_.mac, &msg[4], sizeof(settings_.mac));
+                save_settings();
+            }
         }
 
         if (msg[0] == COMMAND_READ_TRACKING_MODE && msg[1] == true)
@@ -415,77 +1093,88 @@ namespace esphome::ld2450
             bool multi_tracking_state = msg[4] == 0x02;
             if (tracking_mode_switch_ != nullptr)
                 tracking_mode_switch_->publish_state(multi_tracking_state);
+
+            if (settings_.tracking_mode != multi_tracking_state)
+            {
+                settings_.tracking_mode = multi_tracking_state;
+                save_settings();
+            }
         }
     }
 
     void LD2450::log_sensor_version()
     {
-        const uint8_t read_version[2] = {COMMAND_READ_VERSION, 0x00};
-        send_config_message(read_version, 2);
+        const Command commands[] = {{{COMMAND_READ_VERSION, 0x00}, 2}};
+        send_config_messages(commands, 1, "firmware version read");
     }
 
     void LD2450::log_bluetooth_mac()
     {
-        const uint8_t read_mac[4] = {COMMAND_READ_MAC, 0x00, 0x01, 0x00};
-        send_config_message(read_mac, 4);
+        send_config_messages(&READ_MAC_COMMAND, 1, "MAC address read");
     }
 
     void LD2450::perform_restart()
     {
-        const uint8_t restart[2] = {COMMAND_RESTART, 0x00};
-        send_config_message(restart, 2);
-        read_switch_states();
+        // Switch states are read again after the restart
+        const Command commands[] = {RESTART_COMMAND, READ_TRACKING_MODE_COMMAND, READ_MAC_COMMAND};
+        send_config_messages(commands, 3, "restart");
     }
 
     void LD2450::perform_factory_reset()
     {
-        const uint8_t reset[2] = {COMMAND_FACTORY_RESET, 0x00};
-        send_config_message(reset, 2);
-        perform_restart();
+        const Command commands[] = {{{COMMAND_FACTORY_RESET, 0x00}, 2}, RESTART_COMMAND, READ_TRACKING_MODE_COMMAND, READ_MAC_COMMAND};
+        send_config_messages(commands, 4, "factory reset");
     }
 
     void LD2450::set_tracking_mode(bool mode)
     {
-        if (mode)
-        {
-            const uint8_t set_tracking_mode[2] = {COMMAND_MULTI_TRACKING_MODE, 0x00};
-            send_config_message(set_tracking_mode, 2);
-        }
-        else
-        {
-            const uint8_t set_tracking_mode[2] = {COMMAND_SINGLE_TRACKING_MODE, 0x00};
-            send_config_message(set_tracking_mode, 2);
-        }
-
-        const uint8_t request_tracking_mode[2] = {COMMAND_READ_TRACKING_MODE, 0x00};
-        send_config_message(request_tracking_mode, 2);
+        const Command commands[] = {{{uint8_t(mode ? COMMAND_MULTI_TRACKING_MODE : COMMAND_SINGLE_TRACKING_MODE), 0x00}, 2}, READ_TRACKING_MODE_COMMAND};
+        if (!send_config_messages(commands, 2, "tracking mode change") && tracking_mode_switch_ != nullptr)
+            tracking_mode_switch_->publish_state(tracking_mode_switch_->state);
     }
 
     void LD2450::set_bluetooth_state(bool state)
     {
-        const uint8_t set_bt[4] = {COMMAND_BLUETOOTH, 0x00, state, 0x00};
-        send_config_message(set_bt, 4);
-        perform_restart();
+        const Command commands[] = {{{COMMAND_BLUETOOTH, 0x00, uint8_t(state), 0x00}, 4}, RESTART_COMMAND, READ_TRACKING_MODE_COMMAND, READ_MAC_COMMAND};
+        if (!send_config_messages(commands, 4, "bluetooth change") && bluetooth_switch_ != nullptr)
+            bluetooth_switch_->publish_state(bluetooth_switch_->state);
     }
 
     void LD2450::read_switch_states()
     {
-        const uint8_t request_tracking_mode[2] = {COMMAND_READ_TRACKING_MODE, 0x00};
-        send_config_message(request_tracking_mode, 2);
-        log_bluetooth_mac();
+        const Command commands[] = {READ_TRACKING_MODE_COMMAND, READ_MAC_COMMAND};
+        send_config_messages(commands, 2, "switch state read");
     }
 
     void LD2450::set_baud_rate(BaudRate baud_rate)
     {
-        const uint8_t set_baud_rate[4] = {COMMAND_SET_BAUD_RATE, 0x00, baud_rate, 0x00};
-        send_config_message(set_baud_rate, 4);
-        perform_restart();
+        const Command commands[] = {{{COMMAND_SET_BAUD_RATE, 0x00, uint8_t(baud_rate), 0x00}, 4}, RESTART_COMMAND, READ_TRACKING_MODE_COMMAND, READ_MAC_COMMAND};
+        if (send_config_messages(commands, 4, "baud rate change"))
+            requested_baud_rate_ = baud_rate;
+        else if (baud_rate_select_ != nullptr && !baud_rate_select_->state.empty())
+            baud_rate_select_->publish_state(baud_rate_select_->state);
+    }
+
+    bool LD2450::send_config_messages(const Command *commands, uint8_t count, const char *action)
+    {
+        // Sequences are queued completely or not at all, such that a restart is never separated from the command
+        // which requires it. Two slots are reserved for the enter and leave config commands, which are injected by the loop.
+        if (command_queue_.size() + count + 2 > COMMAND_QUEUE_SIZE)
+        {
+            ESP_LOGW(TAG, "Command queue full, dropping %s.", action);
+            return false;
+        }
+        for (uint8_t i = 0; i < count; i++)
+        {
+            command_queue_.push_back(commands[i].data, commands[i].length);
+        }
+        return true;
     }
 
-    void LD2450::write_command(uint8_t *msg, int len)
+    void LD2450::write_command(const uint8_t *msg, int len)
     {
         // Write frame header
-        write_array({0xFD, 0xFC, 0xFB, 0xFA});
+        write_array(config_header, sizeof(config_header));
 
         // Write message length
         write(static_cast<uint8_t>(len));
@@ -495,7 +1184,7 @@ namespace esphome::ld2450
         write_array(msg, len);
 
         // Write frame end
-        write_array({0x04, 0x03, 0x02, 0x01});
+        write_array(config_end, sizeof(config_end));
 
         flush();
     }
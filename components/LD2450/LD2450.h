@@ -1,13 +1,28 @@
 #pragma once
 
+#include <algorithm>
 #include "esphome/core/component.h"
 #include "esphome/components/uart/uart.h"
 #include "esphome/core/helpers.h"
+#include "esphome/core/preferences.h"
+#include "command_queue.h"
 #include "target.h"
 #include "zone.h"
+#include "zone_group.h"
+#include "crossing_line.h"
+#include "heatmap.h"
+#include "interference_mask.h"
+#include "latency_monitor.h"
+#include "trace.h"
 #include "tracking_mode_switch.h"
 #include "bluetooth_switch.h"
 #include "baud_rate_select.h"
+#include "spsc_queue.h"
+#include "seqlock.h"
+#ifdef USE_ESP32
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
 #ifdef USE_BINARY_SENSOR
 #include "esphome/components/binary_sensor/binary_sensor.h"
 #endif
@@ -28,6 +43,22 @@
 #define COMMAND_MAX_RETRIES 10
 #define COMMAND_RETRY_DELAY 100
 
+#define CONFIG_MESSAGE_MAX_LENGTH 20
+#define FRAME_QUEUE_SIZE 8
+#define DECODE_TASK_STACK_SIZE 4096
+#define DECODE_TASK_PRIORITY 5
+#define DECODE_TASK_INTERVAL 5
+
+#define LOOP_TIME_BUDGET 10
+#define LOOP_FRAME_BUDGET 16
+#define STATISTICS_INTERVAL 10000
+#define PUBLISH_SCHEDULER_INTERVAL 50
+#define POSE_FRACTION_BITS 14
+#define AUTO_BAUD_PROBE_TIME 300
+#define AUTO_BAUD_RETRY_INTERVAL 60000
+#define SENSOR_SETTINGS_VERSION 1
+#define SETTING_UNKNOWN 0xFF
+
 #define COMMAND_ENTER_CONFIG 0xFF
 #define COMMAND_LEAVE_CONFIG 0xFE
 #define COMMAND_READ_VERSION 0xA0
@@ -68,10 +99,141 @@ namespace esphome::ld2450
         {"256000", BAUD_256000},
         {"460800", BAUD_460800}};
 
+    /**
+     * @brief Gets the bit rate of a baud rate setting.
+     * @param baud_rate baud rate setting of the sensor
+     * @return bits per second
+     */
+    inline uint32_t baud_rate_to_int(BaudRate baud_rate)
+    {
+        static const uint32_t RATES[] = {9600, 19200, 38400, 57600, 115200, 230400, 256000, 460800};
+        return RATES[baud_rate - BAUD_9600];
+    }
+
     class TrackingModeSwitch;
     class BluetoothSwitch;
     class BaudRateSelect;
 
+    /**
+     * @brief Sensor which publishes the number of transitions between two zones.
+     */
+    struct TransitionSensor
+    {
+        uint8_t from;
+        uint8_t to;
+        sensor::Sensor *sensor;
+    };
+
+    /**
+     * @brief State of a single target within a frame snapshot.
+     */
+    struct TargetSnapshot
+    {
+        int16_t x;
+        int16_t y;
+        int16_t speed;
+        int16_t resolution;
+
+        /// @brief True if the target is detected by the sensor
+        bool present;
+
+        /// @brief True if the position is predicted, as the sensor did not report the target
+        bool predicted;
+    };
+
+    /**
+     * @brief Immutable copy of all targets after processing a frame. Can be read consistently from any task.
+     */
+    struct FrameSnapshot
+    {
+        /// @brief Sequence number of the processed frame
+        uint32_t sequence;
+
+        /// @brief Time at which the header of the frame was received (ms)
+        uint32_t timestamp;
+
+        /// @brief Target states
+        TargetSnapshot targets[3];
+
+        /// @brief Number of detected or predicted targets
+        uint8_t target_count;
+
+        /// @brief True if at least one target is present
+        bool occupied;
+
+        /// @brief True if the sensor is communicating
+        bool sensor_available;
+    };
+
+    /**
+     * @brief Last known settings of the sensor module, persisted to skip config reads during startup.
+     */
+    struct SensorSettings
+    {
+        /// @brief Layout version, mismatching blobs are discarded
+        uint8_t version = SENSOR_SETTINGS_VERSION;
+
+        /// @brief 1 for multi target tracking, 0 for single target tracking, SETTING_UNKNOWN if not read yet
+        uint8_t tracking_mode = SETTING_UNKNOWN;
+
+        /// @brief 1 if bluetooth is enabled, 0 if disabled, SETTING_UNKNOWN if not read yet
+        uint8_t bluetooth = SETTING_UNKNOWN;
+
+        /// @brief True if the firmware version has been read
+        bool has_firmware = false;
+
+        /// @brief Firmware version bytes in display order (major, minor, build)
+        uint8_t firmware[6] = {0};
+
+        /// @brief Bluetooth MAC address of the sensor
+        uint8_t mac[6] = {0};
+    };
+
+    /**
+     * @brief Type of a message received from the sensor.
+     */
+    enum FrameType : uint8_t
+    {
+        FRAME_NONE,
+        FRAME_DATA,
+        FRAME_CONFIG,
+    };
+
+    /**
+     * @brief Raw values reported for a single target slot.
+     */
+    struct TargetReading
+    {
+        int16_t x;
+        int16_t y;
+        int16_t speed;
+        int16_t resolution;
+    };
+
+    /**
+     * @brief Fixed-size decoded message, which can be handed between tasks without allocations.
+     */
+    struct Frame
+    {
+        /// @brief Type of this frame, determines which of the following fields are valid
+        FrameType type = FRAME_NONE;
+
+        /// @brief Time at which the frame header was detected (ms)
+        uint32_t timestamp = 0;
+
+        /// @brief Time at which the frame header was detected (µs), used for latency measurements
+        uint32_t arrival = 0;
+
+        /// @brief Decoded target slots of data frames
+        TargetReading targets[3];
+
+        /// @brief Content length of config frames
+        uint8_t config_length = 0;
+
+        /// @brief Content of config frames
+        uint8_t config[CONFIG_MESSAGE_MAX_LENGTH] = {0};
+    };
+
 #ifdef USE_BUTTON
     /**
      * @brief Empty button definition used as a template for the restart and factory reset buttons.
@@ -93,6 +255,8 @@ namespace esphome::ld2450
 #endif
 #ifdef USE_SENSOR
         SUB_SENSOR(target_count)
+        SUB_SENSOR(collapsed_frames)
+        SUB_SENSOR(time_to_first_occupancy)
 #endif
 #ifdef USE_NUMBER
         SUB_NUMBER(max_distance)
@@ -107,6 +271,7 @@ namespace esphome::ld2450
         void setup() override;
         void loop() override;
         void dump_config() override;
+        void on_shutdown() override;
 
         /**
          * @brief Sets the name of this component
@@ -117,6 +282,15 @@ namespace esphome::ld2450
             name_ = name;
         }
 
+        /**
+         * @brief Sets the id of this component, which is unique per instance unlike the name and identifies its preferences.
+         * @param id id of the component within the configuration
+         */
+        void set_component_id(const char *id)
+        {
+            component_id_ = id;
+        }
+
         /**
          * @brief Adds a target component to the list of targets.
          * @param target Target to add
@@ -134,6 +308,93 @@ namespace esphome::ld2450
             zones_.push_back(zone);
         }
 
+        /**
+         * @brief Adds a zone group to the list of registered zone groups.
+         */
+        void register_zone_group(ZoneGroup *zone_group)
+        {
+            zone_groups_.push_back(zone_group);
+        }
+
+        /**
+         * @brief Sets the interval at which zone dwell times and transition counts are published.
+         * @param interval time in ms
+         */
+        void set_zone_statistics_interval(uint32_t interval)
+        {
+            zone_statistics_interval_ = interval;
+        }
+
+#ifdef USE_SENSOR
+        /**
+         * @brief Adds a sensor which publishes the number of transitions between two zones.
+         * @param from index of the zone which was left
+         * @param to index of the zone which was entered
+         * @param sensor sensor reference
+         */
+        void add_transition_sensor(uint8_t from, uint8_t to, sensor::Sensor *sensor)
+        {
+            transition_sensors_.push_back({from, to, sensor});
+        }
+#endif
+
+        /**
+         * @brief Gets the number of target transitions between two zones.
+         * @param from index of the zone which was left
+         * @param to index of the zone which was entered
+         * @return number of transitions
+         */
+        uint32_t get_transition_count(uint8_t from, uint8_t to)
+        {
+            if (from >= zones_.size() || to >= zones_.size() || transitions_.empty())
+                return 0;
+            return transitions_[from * zones_.size() + to];
+        }
+
+        /**
+         * @brief Enables the dwell heatmap.
+         * @param heatmap heatmap which accounts target positions
+         */
+        void set_heatmap(Heatmap *heatmap)
+        {
+            heatmap_ = heatmap;
+        }
+
+        /**
+         * @brief Enables the interference mask, which discards targets in masked areas.
+         * @param mask interference mask
+         */
+        void set_interference_mask(InterferenceMask *mask)
+        {
+            interference_mask_ = mask;
+        }
+
+        /**
+         * @brief Enables latency measurements of processed frames.
+         * @param monitor latency monitor which accounts the measurements
+         */
+        void set_latency_monitor(LatencyMonitor *monitor)
+        {
+            latency_monitor_ = monitor;
+        }
+
+        /**
+         * @brief Enables tracing of raw measurements of targets with debugging enabled.
+         * @param trace trace buffer which stores the measurements
+         */
+        void set_trace(TraceBuffer *trace)
+        {
+            trace_ = trace;
+        }
+
+        /**
+         * @brief Adds a crossing line to the list of registered lines.
+         */
+        void register_crossing_line(CrossingLine *line)
+        {
+            crossing_lines_.push_back(line);
+        }
+
         /**
          * @brief Sets the x axis inversion flag
          * @param flip true if the x axis should be flipped, false otherwise
@@ -143,6 +404,107 @@ namespace esphome::ld2450
             flip_x_axis_ = flip;
         }
 
+        /**
+         * @brief Sets the mounting pose of the sensor, which transforms sensor coordinates into room coordinates.
+         * The rotation is applied first, followed by the translation. Mirroring is controlled by the flip_x_axis flag.
+         * @param x x coordinate of the sensor within the room in m
+         * @param y y coordinate of the sensor within the room in m
+         * @param rotation counter-clockwise rotation of the sensor in degrees
+         */
+        void set_mounting_pose(float x, float y, float rotation)
+        {
+            has_pose_ = true;
+            pose_x_ = int(x * 1000);
+            pose_y_ = int(y * 1000);
+            pose_cos_ = lroundf(cos(rotation * M_PI / 180) * (1 << POSE_FRACTION_BITS));
+            pose_sin_ = lroundf(sin(rotation * M_PI / 180) * (1 << POSE_FRACTION_BITS));
+        }
+
+        /**
+         * @brief Defers the initial config reads until the first data frame has been processed, such that the first
+         * occupancy state is not delayed by the sensor leaving its streaming mode.
+         * @param enabled true if the config reads should be deferred
+         */
+        void set_fast_startup(bool enabled)
+        {
+            fast_startup_ = enabled;
+        }
+
+        /**
+         * @brief Enables caching of the tracking mode, bluetooth state and firmware version in preferences.
+         * Cached settings are published on boot and not read from the sensor again.
+         * @param enabled true if sensor settings should be cached
+         */
+        void set_cache_settings(bool enabled)
+        {
+            cache_settings_ = enabled;
+        }
+
+        /**
+         * @brief Enables detection of the sensors baud rate. If no valid messages are received, all supported baud rates are probed
+         * and the UART is reconfigured at runtime.
+         * @param upgrade true if the sensor should be moved to 460800 baud once communication is established
+         */
+        void set_auto_baud_rate(bool upgrade)
+        {
+            auto_baud_rate_ = true;
+            upgrade_baud_rate_ = upgrade;
+        }
+
+        /**
+         * @brief Enables decoding of the UART stream within a dedicated task (only available on ESP32).
+         * The main loop will only apply decoded frames and publish results.
+         * @param enabled true if the decode task should be used
+         */
+        void set_decode_task(bool enabled)
+        {
+            use_decode_task_ = enabled;
+        }
+
+        /**
+         * @brief Enables cross-frame association of message slots to targets, such that targets keep their identity if the sensor reorders its slots.
+         * @param enabled true if slots should be associated with the nearest target
+         */
+        void set_target_association(bool enabled)
+        {
+            target_association_ = enabled;
+        }
+
+        /**
+         * @brief Sets the maximum distance between a target and a new measurement, for which the measurement is associated with the target.
+         * @param distance gate distance in m
+         */
+        void set_association_gate(float distance)
+        {
+            association_gate_ = int(distance * 1000);
+        }
+
+        /**
+         * @brief Sets the global budget of target sensor publishes.
+         * Occupancy and count changes are always published, but use up the budget before any target sensors.
+         * @param rate maximum number of publishes per second, 0 for no limitation
+         */
+        void set_max_publish_rate(uint16_t rate)
+        {
+            max_publish_rate_ = rate;
+        }
+
+        /**
+         * @brief Enables constant-velocity prediction for all targets.
+         * @param alpha position correction gain
+         * @param beta velocity correction gain
+         * @param max_coast_frames number of missing measurements which are bridged using the predicted position
+         * @param lookahead time in ms used for predicting zone entries
+         */
+        void set_prediction(float alpha, float beta, uint8_t max_coast_frames, uint32_t lookahead)
+        {
+            prediction_ = true;
+            prediction_alpha_ = alpha;
+            prediction_beta_ = beta;
+            max_coast_frames_ = max_coast_frames;
+            prediction_lookahead_ = lookahead;
+        }
+
         /**
          * @brief Sets the fast of detection flag, which determines how the unoccupied state is determined.
          * @param value true if the x axis flipped
@@ -249,6 +611,16 @@ namespace esphome::ld2450
             return is_occupied_;
         }
 
+        /**
+         * @brief Gets a consistent copy of all targets after the last processed frame.
+         * Unlike get_target(), the snapshot is never half-updated and may be read from any task.
+         * @return snapshot of the last frame
+         */
+        FrameSnapshot get_snapshot() const
+        {
+            return snapshot_.read();
+        }
+
         /**
          * @brief Gets the specified target from this device.
          * @param i target index
@@ -318,35 +690,259 @@ namespace esphome::ld2450
 
     protected:
         /**
-         * @brief Parses the input message and updates related components.
+         * @brief Gets the next decoded message from the decode task queue or the UART stream.
+         * @param frame destination of the decoded message
+         * @return true if a message was decoded, false if no further messages are available
+         */
+        bool next_frame(Frame &frame);
+
+        /**
+         * @brief Reads at most one message from the UART stream.
+         * @param frame destination of the decoded message, the type is FRAME_NONE if no valid message was read
+         * @return true if bytes were consumed and further messages may be available, false otherwise
+         */
+        bool read_frame(Frame &frame);
+
+        /**
+         * @brief Clears the rx buffer in case it has not changed for a long time (overflow recovery).
+         */
+        void check_rx_buffer();
+
+        /**
+         * @brief Decodes the target slots of a data message.
          * @param msg Message buffer
-         * @param len Message content
+         * @param frame frame in which the decoded values are stored
+         */
+        static void decode_targets(const uint8_t *msg, Frame &frame);
+
+        /**
+         * @brief Probes the supported baud rates while no valid messages are received and requests the baud rate upgrade.
+         */
+        void update_auto_baud();
+
+        /**
+         * @brief Reconfigures the UART at runtime and discards bytes received at the previous baud rate.
+         * @param baud_rate new baud rate in bits per second
+         */
+        void set_uart_baud_rate(uint32_t baud_rate);
+
+        /**
+         * @brief Restores cached sensor settings and publishes the related switch states.
+         */
+        void restore_settings();
+
+        /**
+         * @brief Requests all sensor settings which are not known yet.
+         */
+        void run_startup_reads();
+
+        /**
+         * @brief Persists the current sensor settings, if caching is enabled.
+         */
+        void save_settings();
+
+        /**
+         * @brief Publishes instrumentation values to the related diagnostic sensors.
+         */
+        void publish_statistics();
+
+        /**
+         * @brief Publishes due target sensors from a single timer while respecting the global publish budget.
+         */
+        void schedule_publishes();
+
+        /**
+         * @brief Publishes the occupancy state of the hub and all zones, but only for entities which changed since the last commit.
+         * @param target_count number of detected or predicted targets or STATE_UNAVAILABLE
+         */
+        void commit_state(int target_count);
+
+        /**
+         * @brief Transforms a reading from sensor coordinates into room coordinates using the fixed-point mounting pose.
+         * @param reading reading which is transformed in place
+         */
+        void apply_mounting_pose(TargetReading &reading)
+        {
+            int32_t x = (pose_cos_ * reading.x - pose_sin_ * reading.y + (1 << (POSE_FRACTION_BITS - 1))) >> POSE_FRACTION_BITS;
+            int32_t y = (pose_sin_ * reading.x + pose_cos_ * reading.y + (1 << (POSE_FRACTION_BITS - 1))) >> POSE_FRACTION_BITS;
+            reading.x = std::clamp<int32_t>(x + pose_x_, INT16_MIN, INT16_MAX);
+            reading.y = std::clamp<int32_t>(y + pose_y_, INT16_MIN, INT16_MAX);
+        }
+
+        /**
+         * @brief Publishes a snapshot of the current target states.
+         */
+        void publish_snapshot();
+
+        /**
+         * @brief Counts transitions of targets between zones, based on the zones which currently track each target.
+         */
+        void update_transitions();
+
+        /**
+         * @brief Publishes zone dwell times and transition counts and logs the transition matrix.
+         */
+        void publish_zone_statistics();
+
+        /**
+         * @brief Accounts for occupancy and count publishes, which take precedence over target sensors.
+         * @param count number of publishes
+         */
+        void consume_publish_budget(int count)
+        {
+            if (max_publish_rate_ != 0)
+                publish_tokens_ = std::max(publish_tokens_ - count, -float(max_publish_rate_));
+        }
+
+        /**
+         * @brief Applies a decoded message and updates related components.
+         * @param frame decoded message
+         */
+        void apply_frame(const Frame &frame);
+
+        /**
+         * @brief Processes decoded target values and updates related components.
+         * @param frame decoded data message
          */
-        void process_message(uint8_t *msg, int len);
+        void process_message(const Frame &frame);
+
+        /**
+         * @brief Associates message slots with targets using gated nearest-neighbour matching over the 3x3 cost matrix.
+         * @param readings target values of the current message
+         * @param assignment target index for each message slot
+         */
+        void associate_targets(const TargetReading *readings, uint8_t *assignment);
 
         /**
          * @brief Parses the input configuration-message and updates related components.
          * @param msg Message buffer
          * @param len Message length
          */
-        void process_config_message(uint8_t *msg, int len);
+        void process_config_message(const uint8_t *msg, int len);
+
+#ifdef USE_ESP32
+        /**
+         * @brief Entry point of the decode task, which drains the UART and pushes decoded frames into the frame queue.
+         * @param param LD2450 instance
+         */
+        static void decode_task(void *param);
+
+        /// @brief Handle of the decode task, nullptr if decoding happens within the main loop
+        TaskHandle_t decode_task_handle_ = nullptr;
+#endif
+
+        /// @brief Queue of frames decoded by the decode task
+        SpscQueue<Frame, FRAME_QUEUE_SIZE> frame_queue_;
+
+        /// @brief Number of frames which were discarded because the frame queue was full
+        std::atomic<uint32_t> dropped_frames_{0};
+
+        /// @brief Determines whether UART decoding happens within a dedicated task
+        bool use_decode_task_ = false;
+
+        /// @brief Target count which was last published, STATE_UNKNOWN before the first commit
+        int committed_target_count_ = STATE_UNKNOWN;
+
+        /// @brief Sequence number of the last processed frame
+        uint32_t frame_sequence_ = 0;
+
+        /// @brief Header timestamp of the last processed frame (ms)
+        uint32_t last_frame_timestamp_ = 0;
+
+        /// @brief Snapshot of the last processed frame
+        SeqLock<FrameSnapshot> snapshot_;
+
+        /// @brief Number of publish calls issued by state commits
+        uint32_t publish_calls_ = 0;
+
+        /// @brief Number of publishes skipped by state commits, since the entity did not change
+        uint32_t suppressed_publishes_ = 0;
+
+        /// @brief List of all derived target sensors, which are published by the scheduler
+        std::vector<PollingSensor *> polling_sensors_;
+
+        /// @brief Maximum number of publishes per second, 0 for no limitation
+        uint16_t max_publish_rate_ = 0;
+
+        /// @brief Available publishes of the token bucket
+        float publish_tokens_ = 0;
+
+        /// @brief Index of the sensor which is checked first during the next scheduler run
+        size_t publish_cursor_ = 0;
+
+        /// @brief timestamp of the last scheduler run
+        uint32_t last_publish_schedule_ = 0;
+
+        /// @brief Number of data messages which were skipped since a newer message was available
+        uint32_t collapsed_frames_ = 0;
+
+        /// @brief timestamp of the last instrumentation update
+        uint32_t last_statistics_update_ = 0;
+
+        /// @brief Determines whether the baud rate of the sensor is detected automatically
+        bool auto_baud_rate_ = false;
+
+        /// @brief Determines whether the sensor is moved to 460800 baud after detection
+        bool upgrade_baud_rate_ = false;
+
+        /// @brief Indicates that the upgrade to 460800 baud has been requested
+        bool baud_rate_upgrade_requested_ = false;
+
+        /// @brief Indicates that baud rates are currently probed
+        bool baud_probing_ = false;
+
+        /// @brief Index of the currently probed baud rate
+        uint8_t probe_index_ = 0;
+
+        /// @brief timestamp at which the current baud rate probe started
+        uint32_t probe_started_ = 0;
+
+        /// @brief timestamp at which the last unsuccessful probe cycle ended, 0 if none
+        uint32_t last_probe_cycle_ = 0;
+
+        /// @brief Baud rate at which valid messages were last received in bits per second
+        uint32_t known_baud_rate_ = 0;
+
+        /// @brief Baud rate sent to the sensor with the last set baud rate command
+        BaudRate requested_baud_rate_ = BAUD_256000;
+
+        /// @brief Baud rate which is applied to the UART once the sensor restarts, 0 if none
+        uint32_t pending_baud_rate_ = 0;
+
+        /// @brief Determines whether the initial config reads are deferred until the first data frame
+        bool fast_startup_ = false;
+
+        /// @brief Determines whether sensor settings are cached in preferences
+        bool cache_settings_ = false;
+
+        /// @brief Indicates that the initial config reads have not been requested yet
+        bool startup_reads_pending_ = false;
+
+        /// @brief Indicates that a data frame has been processed since boot
+        bool first_frame_processed_ = false;
+
+        /// @brief Last known settings of the sensor module
+        SensorSettings settings_;
+
+        /// @brief Preference storing the cached sensor settings
+        ESPPreferenceObject settings_pref_;
 
         /**
          * @brief Generates message header/end and writes the command to UART
          * @param msg command buffer
          * @param len command length
          */
-        void write_command(uint8_t *msg, int len);
+        void write_command(const uint8_t *msg, int len);
 
         /**
-         * @brief Submits a config message for being sent out. If the config command is not acknowledged after a fixed retry count, the command will be discarded.
-         * @param msg Message buffer
-         * @param msg Message length
+         * @brief Submits a sequence of config messages for being sent out. If a config command is not acknowledged after a fixed retry count, the command will be discarded.
+         * @param commands commands in sending order
+         * @param count number of commands
+         * @param action name of the user action, used for logging
+         * @return false if the queue cannot hold the whole sequence, no command is queued in this case and the entity which
+         * requested the action republishes its previous state
          */
-        void send_config_message(const uint8_t *msg, int len)
-        {
-            command_queue_.push_back(std::vector<uint8_t>(msg, msg + len));
-        }
+        bool send_config_messages(const Command *commands, uint8_t count, const char *action);
 
         /// @brief indicates whether the start sequence has been parsed
         uint8_t peek_status_ = 0;
@@ -354,12 +950,47 @@ namespace esphome::ld2450
         /// @brief Name of this component
         const char *name_ = "LD2450";
 
+        /// @brief Id of this component, the name is used for preference keys if not set
+        const char *component_id_ = nullptr;
+
         /// @brief Determines whether the x values are inverted
         bool flip_x_axis_ = false;
 
+        /// @brief Determines whether a mounting pose is applied
+        bool has_pose_ = false;
+
+        /// @brief Position of the sensor within the room in mm
+        int32_t pose_x_ = 0;
+        int32_t pose_y_ = 0;
+
+        /// @brief Cosine and sine of the sensor rotation, scaled by 2^POSE_FRACTION_BITS
+        int32_t pose_cos_ = 1 << POSE_FRACTION_BITS;
+        int32_t pose_sin_ = 0;
+
         /// @brief indicates whether a target is detected
         bool is_occupied_ = false;
 
+        /// @brief Determines whether target positions are predicted
+        bool prediction_ = false;
+
+        /// @brief Position correction gain used for prediction
+        float prediction_alpha_ = 0.5f;
+
+        /// @brief Velocity correction gain used for prediction
+        float prediction_beta_ = 0.1f;
+
+        /// @brief Maximum number of missing measurements bridged by prediction
+        uint8_t max_coast_frames_ = 2;
+
+        /// @brief Prediction time in ms used for zone entries
+        uint32_t prediction_lookahead_ = 200;
+
+        /// @brief Determines whether message slots are associated with the nearest target
+        bool target_association_ = false;
+
+        /// @brief Maximum distance in mm between a target and a measurement which is associated with it
+        int16_t association_gate_ = 1000;
+
         /// @brief Determines whether the fast unoccupied detection method is applied
         bool fast_off_detection_ = false;
 
@@ -375,6 +1006,12 @@ namespace esphome::ld2450
         /// @brief Expected length of the configuration message
         int configuration_message_length_ = 0;
 
+        /// @brief timestamp at which the header of the current message was detected
+        uint32_t frame_timestamp_ = 0;
+
+        /// @brief timestamp in µs at which the header of the current message was detected
+        uint32_t frame_arrival_ = 0;
+
         /// @brief timestamp of the last message which was sent to the sensor
         uint32_t command_last_sent_ = 0;
 
@@ -394,7 +1031,7 @@ namespace esphome::ld2450
         int last_available_size_ = 0;
 
         /// @brief Queue of commands to execute
-        std::vector<std::vector<uint8_t>> command_queue_;
+        CommandQueue command_queue_;
 
         /// @brief Nr of times the command has been written to UART
         int command_send_retries_ = 0;
@@ -417,9 +1054,50 @@ namespace esphome::ld2450
         /// @brief List of registered and mock tracking targets
         std::vector<Target *> targets_;
 
+        /// @brief Storage of mock targets, which fill up the target list if less than 3 targets are registered
+        Target mock_targets_[3];
+
+        /// @brief Number of targets which were registered from the configuration
+        uint8_t registered_target_count_ = 0;
+
         /// @brief List of registered zones
         std::vector<Zone *> zones_;
 
+        /// @brief List of registered zone groups
+        std::vector<ZoneGroup *> zone_groups_;
+
+        /// @brief Transition counts between zones, stored row-wise (from x to)
+        std::vector<uint32_t> transitions_;
+
+        /// @brief Index of the zone each target was last tracked in, -1 for none
+        int8_t last_zone_[3] = {-1, -1, -1};
+
+#ifdef USE_SENSOR
+        /// @brief Sensors which publish transition counts
+        std::vector<TransitionSensor> transition_sensors_;
+#endif
+
+        /// @brief Interval at which zone statistics are published in ms
+        uint32_t zone_statistics_interval_ = 60000;
+
+        /// @brief Timestamp of the last zone statistics publish
+        uint32_t last_zone_statistics_update_ = 0;
+
+        /// @brief Interference mask, nullptr if disabled
+        InterferenceMask *interference_mask_ = nullptr;
+
+        /// @brief Dwell heatmap, nullptr if disabled
+        Heatmap *heatmap_ = nullptr;
+
+        /// @brief Latency monitor, nullptr if disabled
+        LatencyMonitor *latency_monitor_ = nullptr;
+
+        /// @brief Trace of raw target measurements, nullptr if disabled
+        TraceBuffer *trace_ = nullptr;
+
+        /// @brief List of registered crossing lines
+        std::vector<CrossingLine *> crossing_lines_;
+
         /// @brief Tracking mode switch which enables/disables multi-target tracking
         TrackingModeSwitch *tracking_mode_switch_ = nullptr;
 
@@ -17,11 +17,14 @@ from esphome.const import (
     CONF_INTERNAL,
     CONF_LAMBDA,
     CONF_NAME,
+    CONF_RESTORE,
     CONF_RESTORE_VALUE,
     CONF_STEP,
+    CONF_TRIGGER_ID,
     CONF_UNIT_OF_MEASUREMENT,
     CONF_UPDATE_INTERVAL,
     DEVICE_CLASS_DISTANCE,
+    DEVICE_CLASS_DURATION,
     DEVICE_CLASS_OCCUPANCY,
     DEVICE_CLASS_RESTART,
     DEVICE_CLASS_SPEED,
@@ -30,10 +33,14 @@ from esphome.const import (
     ICON_BLUETOOTH,
     ICON_RESTART_ALERT,
     STATE_CLASS_MEASUREMENT,
+    STATE_CLASS_TOTAL_INCREASING,
     UNIT_CENTIMETER,
     UNIT_DEGREES,
     UNIT_METER,
+    UNIT_MILLISECOND,
+    UNIT_SECOND,
 )
+from esphome.core import CORE
 
 MULTI_CONF = True
 AUTO_LOAD = ["binary_sensor", "number", "sensor", "button", "switch", "select"]
@@ -43,7 +50,17 @@ DEPENDENCIES = ["uart"]
 UART_ID = "uart_id"
 
 CONF_USE_FAST_OFF = "fast_off_detection"
+CONF_DECODE_TASK = "decode_task"
+CONF_TARGET_ASSOCIATION = "target_association"
+CONF_ASSOCIATION_GATE = "association_gate"
+CONF_PREDICTION = "prediction"
+CONF_ALPHA = "alpha"
+CONF_BETA = "beta"
+CONF_MAX_COAST_FRAMES = "max_coast_frames"
+CONF_LOOKAHEAD = "lookahead"
 CONF_FLIP_X_AXIS = "flip_x_axis"
+CONF_MOUNTING_POSE = "mounting_pose"
+CONF_ROTATION = "rotation"
 CONF_OCCUPANCY = "occupancy"
 CONF_TARGET_COUNT = "target_count"
 CONF_MAX_TILT_ANGLE = "max_detection_tilt_angle"
@@ -60,31 +77,99 @@ CONF_SPEED_SENSOR = "speed"
 CONF_DISTANCE_SENSOR = "distance"
 CONF_DISTANCE_RESOLUTION_SENSOR = "distance_resolution"
 CONF_ANGLE_SENSOR = "angle"
+CONF_HEADING_SENSOR = "heading"
+CONF_RADIAL_VELOCITY_SENSOR = "radial_velocity"
+CONF_STATIONARY = "stationary"
+CONF_STATIONARY_THRESHOLD = "stationary_threshold"
 CONF_ZONES = "zones"
 CONF_ZONE = "zone"
+CONF_ZONE_GROUPS = "zone_groups"
+CONF_OCCUPIED_ZONES = "occupied_zones"
+CONF_LINES = "lines"
+CONF_LINE = "line"
+CONF_START = "start"
+CONF_END = "end"
+CONF_IN_COUNT = "in_count"
+CONF_OUT_COUNT = "out_count"
+CONF_SAVE_INTERVAL = "save_interval"
+CONF_DWELL_TIME = "dwell_time"
+CONF_ZONE_TRANSITIONS = "zone_transitions"
+CONF_ZONE_STATISTICS_INTERVAL = "zone_statistics_interval"
+CONF_FROM = "from"
+CONF_HEATMAP = "heatmap"
+CONF_WIDTH = "width"
+CONF_DEPTH = "depth"
+CONF_CELL_SIZE = "cell_size"
+CONF_X_MIN = "x_min"
+CONF_Y_MIN = "y_min"
+CONF_INTERFERENCE_MASK = "interference_mask"
+CONF_REGIONS = "regions"
+CONF_RECTANGLE = "rectangle"
+CONF_LEARNING = "learning"
+CONF_STATIONARY_TIME = "stationary_time"
+CONF_TO = "to"
 CONF_MARGIN = "margin"
 CONF_TARGET_TIMEOUT = "target_timeout"
+CONF_ON_DELAY = "on_delay"
+CONF_OFF_DELAY = "off_delay"
+CONF_MIN_DWELL = "min_dwell"
+CONF_ON_ENTER = "on_enter"
+CONF_RESTORE_POLYGON = "restore_polygon"
+CONF_PERSIST = "persist"
+CONF_ON_EXIT = "on_exit"
 CONF_POLYGON = "polygon"
 CONF_POINT = "point"
 CONF_X = "x"
 CONF_Y = "y"
+CONF_CIRCLE = "circle"
+CONF_RING = "ring"
+CONF_SECTOR = "sector"
+CONF_CENTER = "center"
+CONF_RADIUS = "radius"
+CONF_INNER_RADIUS = "inner_radius"
+CONF_OUTER_RADIUS = "outer_radius"
+CONF_SECTOR_MIN_DISTANCE = "min_distance"
+CONF_SECTOR_MAX_DISTANCE = "max_distance"
+CONF_START_ANGLE = "start_angle"
+CONF_END_ANGLE = "end_angle"
 CONF_RESTART_BUTTON = "restart_button"
 CONF_FACTORY_RESET_BUTTON = "factory_reset_button"
 CONF_TRACKING_MODE_SWITCH = "tracking_mode_switch"
 CONF_BLUETOOTH_SWITCH = "bluetooth_switch"
 CONF_BAUD_RATE_SELECT = "baud_rate_select"
+CONF_COLLAPSED_FRAMES = "collapsed_frames"
+CONF_FAST_STARTUP = "fast_startup"
+CONF_CACHE_SETTINGS = "cache_settings"
+CONF_TIME_TO_FIRST_OCCUPANCY = "time_to_first_occupancy"
+CONF_LATENCY = "latency"
+CONF_AUTO_BAUD_RATE = "auto_baud_rate"
+CONF_UPGRADE = "upgrade"
+CONF_QUEUE = "queue"
+CONF_PROCESSING = "processing"
+CONF_PUBLISH = "publish"
+CONF_END_TO_END = "end_to_end"
+CONF_TRACE = "trace"
+CONF_SIZE = "size"
+CONF_MAX_PUBLISH_RATE = "max_publish_rate"
+CONF_DEADBAND = "deadband"
 UNIT_METER_PER_SECOND = "m/s"
 ICON_ANGLE_ACUTE = "mdi:angle-acute"
 ICON_ACCOUNT_GROUP = "mdi:account-group"
 
 ld2450_ns = cg.esphome_ns.namespace("ld2450")
 LD2450 = ld2450_ns.class_("LD2450", cg.Component, uart.UARTDevice)
-Target = ld2450_ns.class_("Target", cg.Component)
+Target = ld2450_ns.class_("Target")
 MaxTiltAngleNumber = ld2450_ns.class_("LimitNumber", cg.Component)
 MinTiltAngleNumber = ld2450_ns.class_("LimitNumber", cg.Component)
 MaxDistanceNumber = ld2450_ns.class_("LimitNumber", cg.Component)
-PollingSensor = ld2450_ns.class_("PollingSensor", cg.PollingComponent)
+PollingSensor = ld2450_ns.class_("PollingSensor", sensor.Sensor)
 Zone = ld2450_ns.class_("Zone")
+ZoneGroup = ld2450_ns.class_("ZoneGroup")
+CrossingLine = ld2450_ns.class_("CrossingLine")
+Heatmap = ld2450_ns.class_("Heatmap")
+InterferenceMask = ld2450_ns.class_("InterferenceMask")
+LatencyMonitor = ld2450_ns.class_("LatencyMonitor")
+TraceBuffer = ld2450_ns.class_("TraceBuffer")
 Point = ld2450_ns.class_("Point")
 EmptyButton = ld2450_ns.class_("EmptyButton", button.Button, cg.Component)
 TrackingModeSwitch = ld2450_ns.class_("TrackingModeSwitch", switch.Switch, cg.Component)
@@ -92,62 +177,81 @@ BluetoothSwitch = ld2450_ns.class_("BluetoothSwitch", switch.Switch, cg.Componen
 BaudRateSelect = ld2450_ns.class_("BaudRateSelect", select.Select, cg.Component)
 LimitTypeEnum = ld2450_ns.enum("LimitType")
 UpdatePolygonAction = ld2450_ns.class_("UpdatePolygonAction", automation.Action)
+ResetCrossingLineAction = ld2450_ns.class_("ResetCrossingLineAction", automation.Action)
+DumpHeatmapAction = ld2450_ns.class_("DumpHeatmapAction", automation.Action)
+ResetHeatmapAction = ld2450_ns.class_("ResetHeatmapAction", automation.Action)
+ClearLearnedMaskAction = ld2450_ns.class_("ClearLearnedMaskAction", automation.Action)
+DumpLatencyAction = ld2450_ns.class_("DumpLatencyAction", automation.Action)
+ResetLatencyAction = ld2450_ns.class_("ResetLatencyAction", automation.Action)
+DumpTraceAction = ld2450_ns.class_("DumpTraceAction", automation.Action)
+ClearTraceAction = ld2450_ns.class_("ClearTraceAction", automation.Action)
+ZoneTrigger = ld2450_ns.class_(
+    "ZoneTrigger", automation.Trigger.template(cg.uint8, cg.uint32)
+)
 
 
-DISTANCE_SENSOR_SCHEMA = (
-    sensor.sensor_schema(
-        unit_of_measurement=UNIT_METER,
-        accuracy_decimals=2,
-        state_class=STATE_CLASS_MEASUREMENT,
-        device_class=DEVICE_CLASS_DISTANCE,
-    )
-    .extend(cv.polling_component_schema("1s"))
-    .extend(
-        {
-            cv.GenerateID(): cv.declare_id(PollingSensor),
-            cv.Optional(CONF_UNIT_OF_MEASUREMENT, default=UNIT_METER): cv.All(
-                cv.one_of(UNIT_METER, UNIT_CENTIMETER),
-            ),
-        }
-    )
+DISTANCE_SENSOR_SCHEMA = sensor.sensor_schema(
+    unit_of_measurement=UNIT_METER,
+    accuracy_decimals=2,
+    state_class=STATE_CLASS_MEASUREMENT,
+    device_class=DEVICE_CLASS_DISTANCE,
+).extend(
+    {
+        cv.GenerateID(): cv.declare_id(PollingSensor),
+        cv.Optional(CONF_UPDATE_INTERVAL, default="1s"): cv.update_interval,
+        cv.Optional(CONF_DEADBAND, default="0m"): cv.distance,
+        cv.Optional(CONF_UNIT_OF_MEASUREMENT, default=UNIT_METER): cv.All(
+            cv.one_of(UNIT_METER, UNIT_CENTIMETER),
+        ),
+    }
 )
 
-SPEED_SENSOR_SCHEMA = (
-    sensor.sensor_schema(
-        unit_of_measurement=UNIT_METER_PER_SECOND,
-        accuracy_decimals=0,
-        state_class=STATE_CLASS_MEASUREMENT,
-        device_class=DEVICE_CLASS_SPEED,
-    )
-    .extend(cv.polling_component_schema("1s"))
-    .extend(
-        {
-            cv.GenerateID(): cv.declare_id(PollingSensor),
-            cv.Optional(
-                CONF_UNIT_OF_MEASUREMENT, default=UNIT_METER_PER_SECOND
-            ): cv.All(
-                cv.one_of(UNIT_METER_PER_SECOND),
-            ),
-        }
-    )
+SPEED_SENSOR_SCHEMA = sensor.sensor_schema(
+    unit_of_measurement=UNIT_METER_PER_SECOND,
+    accuracy_decimals=0,
+    state_class=STATE_CLASS_MEASUREMENT,
+    device_class=DEVICE_CLASS_SPEED,
+).extend(
+    {
+        cv.GenerateID(): cv.declare_id(PollingSensor),
+        cv.Optional(CONF_UPDATE_INTERVAL, default="1s"): cv.update_interval,
+        cv.Optional(CONF_DEADBAND, default=0): cv.positive_float,
+        cv.Optional(CONF_UNIT_OF_MEASUREMENT, default=UNIT_METER_PER_SECOND): cv.All(
+            cv.one_of(UNIT_METER_PER_SECOND),
+        ),
+    }
 )
 
-DEGREE_SENSOR_SCHEMA = (
-    sensor.sensor_schema(
-        unit_of_measurement=UNIT_DEGREES,
-        accuracy_decimals=0,
-        state_class=STATE_CLASS_MEASUREMENT,
-        icon=ICON_ANGLE_ACUTE,
-    )
-    .extend(cv.polling_component_schema("1s"))
-    .extend(
-        {
-            cv.GenerateID(): cv.declare_id(PollingSensor),
-            cv.Optional(CONF_UNIT_OF_MEASUREMENT, default=UNIT_DEGREES): cv.All(
-                cv.one_of(UNIT_DEGREES),
-            ),
-        }
-    )
+VELOCITY_SENSOR_SCHEMA = sensor.sensor_schema(
+    unit_of_measurement=UNIT_METER_PER_SECOND,
+    accuracy_decimals=2,
+    state_class=STATE_CLASS_MEASUREMENT,
+    device_class=DEVICE_CLASS_SPEED,
+).extend(
+    {
+        cv.GenerateID(): cv.declare_id(PollingSensor),
+        cv.Optional(CONF_UPDATE_INTERVAL, default="1s"): cv.update_interval,
+        cv.Optional(CONF_DEADBAND, default=0): cv.positive_float,
+        cv.Optional(CONF_UNIT_OF_MEASUREMENT, default=UNIT_METER_PER_SECOND): cv.All(
+            cv.one_of(UNIT_METER_PER_SECOND),
+        ),
+    }
+)
+
+DEGREE_SENSOR_SCHEMA = sensor.sensor_schema(
+    unit_of_measurement=UNIT_DEGREES,
+    accuracy_decimals=0,
+    state_class=STATE_CLASS_MEASUREMENT,
+    icon=ICON_ANGLE_ACUTE,
+).extend(
+    {
+        cv.GenerateID(): cv.declare_id(PollingSensor),
+        cv.Optional(CONF_UPDATE_INTERVAL, default="1s"): cv.update_interval,
+        cv.Optional(CONF_DEADBAND, default="0°"): cv.angle,
+        cv.Optional(CONF_UNIT_OF_MEASUREMENT, default=UNIT_DEGREES): cv.All(
+            cv.one_of(UNIT_DEGREES),
+        ),
+    }
 )
 
 TARGET_SCHEMA = cv.Schema(
@@ -177,11 +281,36 @@ TARGET_SCHEMA = cv.Schema(
                 cv.Optional(CONF_DISTANCE_SENSOR): DISTANCE_SENSOR_SCHEMA.extend(
                     cv.Schema({cv.Optional(CONF_NAME): cv.string_strict})
                 ),
+                cv.Optional(CONF_HEADING_SENSOR): DEGREE_SENSOR_SCHEMA.extend(
+                    cv.Schema({cv.Optional(CONF_NAME): cv.string_strict})
+                ),
+                cv.Optional(CONF_RADIAL_VELOCITY_SENSOR): VELOCITY_SENSOR_SCHEMA.extend(
+                    cv.Schema({cv.Optional(CONF_NAME): cv.string_strict})
+                ),
+                cv.Optional(
+                    CONF_STATIONARY
+                ): binary_sensor.binary_sensor_schema().extend(
+                    cv.Schema({cv.Optional(CONF_NAME): cv.string_strict})
+                ),
+                cv.Optional(CONF_STATIONARY_THRESHOLD, default="10cm"): cv.All(
+                    cv.distance, cv.Range(min=0.0)
+                ),
             }
         ),
     }
 )
 
+PREDICTION_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_ALPHA, default=0.5): cv.zero_to_one_float,
+        cv.Optional(CONF_BETA, default=0.1): cv.zero_to_one_float,
+        cv.Optional(CONF_MAX_COAST_FRAMES, default=2): cv.int_range(min=0, max=3),
+        cv.Optional(
+            CONF_LOOKAHEAD, default="200ms"
+        ): cv.positive_time_period_milliseconds,
+    }
+)
+
 POLYGON_SCHEMA = cv.Schema(
     {
         cv.Required(CONF_POINT): cv.Schema(
@@ -193,6 +322,77 @@ POLYGON_SCHEMA = cv.Schema(
     }
 )
 
+CENTER_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_X, default="0m"): cv.distance,
+        cv.Optional(CONF_Y, default="0m"): cv.distance,
+    }
+)
+
+
+def validate_ring(config):
+    """Assert that the inner radius of a ring is smaller than the outer radius."""
+    if config[CONF_INNER_RADIUS] >= config[CONF_OUTER_RADIUS]:
+        raise cv.Invalid(
+            f"{CONF_INNER_RADIUS} must be smaller than {CONF_OUTER_RADIUS}"
+        )
+    return config
+
+
+def validate_sector(config):
+    """Assert that the sector boundaries are ordered and span at most 180 degrees."""
+    if config[CONF_SECTOR_MIN_DISTANCE] >= config[CONF_SECTOR_MAX_DISTANCE]:
+        raise cv.Invalid(
+            f"{CONF_SECTOR_MIN_DISTANCE} must be smaller than {CONF_SECTOR_MAX_DISTANCE}"
+        )
+    if config[CONF_START_ANGLE] >= config[CONF_END_ANGLE]:
+        raise cv.Invalid(f"{CONF_START_ANGLE} must be smaller than {CONF_END_ANGLE}")
+    if config[CONF_END_ANGLE] - config[CONF_START_ANGLE] > 180:
+        raise cv.Invalid("Sectors must not span more than 180°")
+    return config
+
+
+CIRCLE_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_CENTER, default={}): CENTER_SCHEMA,
+        cv.Required(CONF_RADIUS): cv.All(
+            cv.distance, cv.Range(min=0.0, min_included=False)
+        ),
+    }
+)
+
+RING_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.Optional(CONF_CENTER, default={}): CENTER_SCHEMA,
+            cv.Required(CONF_INNER_RADIUS): cv.All(cv.distance, cv.Range(min=0.0)),
+            cv.Required(CONF_OUTER_RADIUS): cv.All(cv.distance, cv.Range(min=0.0)),
+        }
+    ),
+    validate_ring,
+)
+
+SECTOR_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.Optional(CONF_CENTER, default={}): CENTER_SCHEMA,
+            cv.Optional(CONF_SECTOR_MIN_DISTANCE, default="0m"): cv.All(
+                cv.distance, cv.Range(min=0.0)
+            ),
+            cv.Required(CONF_SECTOR_MAX_DISTANCE): cv.All(
+                cv.distance, cv.Range(min=0.0)
+            ),
+            cv.Required(CONF_START_ANGLE): cv.All(
+                cv.angle, cv.Range(min=-180.0, max=180.0)
+            ),
+            cv.Required(CONF_END_ANGLE): cv.All(
+                cv.angle, cv.Range(min=-180.0, max=180.0)
+            ),
+        }
+    ),
+    validate_sector,
+)
+
 
 def is_convex(points):
     """Determine if the polygon given by the list of points is convex."""
@@ -217,7 +417,7 @@ def is_convex(points):
 def validate_polygon(config):
     """Assert that the provided polygon is convex."""
 
-    if CONF_LAMBDA in config.get(CONF_POLYGON, []):
+    if CONF_POLYGON not in config or CONF_LAMBDA in config[CONF_POLYGON]:
         return config
 
     points = []
@@ -234,8 +434,21 @@ def validate_polygon(config):
     return config
 
 
+def validate_restore_polygon(config):
+    """Assert that persisted polygons only replace static polygons."""
+    if not config[CONF_RESTORE_POLYGON]:
+        return config
+    if CONF_POLYGON not in config:
+        raise cv.Invalid(f"{CONF_RESTORE_POLYGON} can only be used with polygon zones")
+    if CONF_LAMBDA in config[CONF_POLYGON]:
+        raise cv.Invalid(
+            f"{CONF_RESTORE_POLYGON} cannot be used with template polygons"
+        )
+    return config
+
+
 def validate_names(config):
-    """Assert that sensors provide a name or inherited it from their parent zone."""
+    """Assert that sensors provide a name or inherited it from their parent zone or zone group."""
 
     if occupancy_config := config.get(CONF_OCCUPANCY):
         # By default ESPHome chooses the entity id as the name of the component or the config-provided name
@@ -265,6 +478,70 @@ def validate_names(config):
             target_count_config[CONF_NAME] = config[CONF_NAME]
             target_count_config[CONF_INTERNAL] = False
 
+    if dwell_time_config := config.get(CONF_DWELL_TIME):
+        if CONF_NAME in dwell_time_config and str(dwell_time_config[CONF_NAME]) != str(
+            dwell_time_config[CONF_ID]
+        ):
+            dwell_time_config[CONF_NAME] = (
+                f"{config[CONF_NAME]} {dwell_time_config[CONF_NAME]}"
+            )
+        else:
+            dwell_time_config[CONF_NAME] = config[CONF_NAME]
+            dwell_time_config[CONF_INTERNAL] = False
+
+    if occupied_zones_config := config.get(CONF_OCCUPIED_ZONES):
+        if CONF_NAME in occupied_zones_config and str(
+            occupied_zones_config[CONF_NAME]
+        ) != str(occupied_zones_config[CONF_ID]):
+            occupied_zones_config[CONF_NAME] = (
+                f"{config[CONF_NAME]} {occupied_zones_config[CONF_NAME]}"
+            )
+        else:
+            occupied_zones_config[CONF_NAME] = config[CONF_NAME]
+            occupied_zones_config[CONF_INTERNAL] = False
+
+    return config
+
+
+def validate_zone_groups(config):
+    """Assert that zone groups only reference zones of the same sensor and that all zones fit into the group bitmask."""
+
+    if zone_groups_config := config.get(CONF_ZONE_GROUPS):
+        zone_ids = [
+            str(zone_config[CONF_ZONE][CONF_ID])
+            for zone_config in config.get(CONF_ZONES, [])
+        ]
+        if len(zone_ids) > 32:
+            raise cv.Invalid("Zone groups can only be used with up to 32 zones.")
+        for zone_group_config in zone_groups_config:
+            for zone_id in zone_group_config[CONF_ZONES]:
+                if str(zone_id) not in zone_ids:
+                    raise cv.Invalid(
+                        f"Zone '{zone_id}' of zone group '{zone_group_config[CONF_NAME]}' is not a zone of this sensor."
+                    )
+
+    return config
+
+
+def validate_zone_transitions(config):
+    """Assert that zone transition sensors only reference zones of the same sensor."""
+
+    if transitions_config := config.get(CONF_ZONE_TRANSITIONS):
+        zone_ids = [
+            str(zone_config[CONF_ZONE][CONF_ID])
+            for zone_config in config.get(CONF_ZONES, [])
+        ]
+        for transition_config in transitions_config:
+            for zone_id in (transition_config[CONF_FROM], transition_config[CONF_TO]):
+                if str(zone_id) not in zone_ids:
+                    raise cv.Invalid(
+                        f"Zone '{zone_id}' of a zone transition is not a zone of this sensor."
+                    )
+            if str(transition_config[CONF_FROM]) == str(transition_config[CONF_TO]):
+                raise cv.Invalid(
+                    f"{CONF_FROM} and {CONF_TO} of a zone transition must differ."
+                )
+
     return config
 
 
@@ -291,6 +568,9 @@ def validate_target_names(config):
                 (CONF_DISTANCE_RESOLUTION_SENSOR, "Distance Resolution"),
                 (CONF_ANGLE_SENSOR, "Angle"),
                 (CONF_DISTANCE_SENSOR, "Distance"),
+                (CONF_HEADING_SENSOR, "Heading"),
+                (CONF_RADIAL_VELOCITY_SENSOR, "Radial Velocity"),
+                (CONF_STATIONARY, "Stationary"),
             ]:
                 if sensor_config := target_config_content.get(sensor):
                     # Add Target name as prefix to sensor name
@@ -309,6 +589,32 @@ def validate_target_names(config):
     return config
 
 
+def validate_decode_task(config):
+    """Assert that the decode task is only used on platforms with FreeRTOS tasks."""
+    if config[CONF_DECODE_TASK] and not CORE.is_esp32:
+        raise cv.Invalid(f"{CONF_DECODE_TASK} is only available on ESP32")
+    return config
+
+
+def validate_auto_baud_rate(config):
+    """Assert that the UART is not reconfigured while it is read by the decode task."""
+    if CONF_AUTO_BAUD_RATE in config and config[CONF_DECODE_TASK]:
+        raise cv.Invalid(
+            f"{CONF_AUTO_BAUD_RATE} cannot be used with {CONF_DECODE_TASK}"
+        )
+    return config
+
+
+def validate_trace(config):
+    """Add a trace with default options if a target is debugged without a configured trace."""
+    if CONF_TRACE not in config and any(
+        target_config[CONF_TARGET][CONF_DEBUG]
+        for target_config in config.get(CONF_TARGETS, [])
+    ):
+        config[CONF_TRACE] = TRACE_SCHEMA({})
+    return config
+
+
 def validate_min_max_angle(config):
     """Assert that the min and max tilt angles do not exceed each other."""
 
@@ -346,7 +652,17 @@ ZONE_SCHEMA = cv.Schema(
                 cv.Optional(
                     CONF_TARGET_TIMEOUT, default="5s"
                 ): cv.positive_time_period_milliseconds,
-                cv.Required(CONF_POLYGON): cv.Any(
+                cv.Optional(
+                    CONF_ON_DELAY, default="0s"
+                ): cv.positive_time_period_milliseconds,
+                cv.Optional(
+                    CONF_OFF_DELAY, default="0s"
+                ): cv.positive_time_period_milliseconds,
+                cv.Optional(
+                    CONF_MIN_DWELL, default="0s"
+                ): cv.positive_time_period_milliseconds,
+                cv.Optional(CONF_RESTORE_POLYGON, default=False): cv.boolean,
+                cv.Optional(CONF_POLYGON): cv.Any(
                     cv.All(cv.ensure_list(POLYGON_SCHEMA), cv.Length(min=3)),
                     cv.Schema(
                         {
@@ -359,19 +675,239 @@ ZONE_SCHEMA = cv.Schema(
                         }
                     ),
                 ),
+                cv.Optional(CONF_CIRCLE): CIRCLE_SCHEMA,
+                cv.Optional(CONF_RING): RING_SCHEMA,
+                cv.Optional(CONF_SECTOR): SECTOR_SCHEMA,
                 cv.Optional(CONF_OCCUPANCY): binary_sensor.binary_sensor_schema(
                     device_class=DEVICE_CLASS_OCCUPANCY,
                 ).extend(cv.Schema({cv.Optional(CONF_NAME): cv.string_strict})),
                 cv.Optional(CONF_TARGET_COUNT): sensor.sensor_schema(
                     accuracy_decimals=0,
                 ).extend(cv.Schema({cv.Optional(CONF_NAME): cv.string_strict})),
+                cv.Optional(CONF_DWELL_TIME): sensor.sensor_schema(
+                    unit_of_measurement=UNIT_SECOND,
+                    accuracy_decimals=0,
+                    device_class=DEVICE_CLASS_DURATION,
+                    state_class=STATE_CLASS_TOTAL_INCREASING,
+                ).extend(cv.Schema({cv.Optional(CONF_NAME): cv.string_strict})),
+                cv.Optional(CONF_ON_ENTER): automation.validate_automation(
+                    {cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(ZoneTrigger)}
+                ),
+                cv.Optional(CONF_ON_EXIT): automation.validate_automation(
+                    {cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(ZoneTrigger)}
+                ),
             },
+            cv.has_exactly_one_key(CONF_POLYGON, CONF_CIRCLE, CONF_RING, CONF_SECTOR),
             validate_polygon,
+            validate_restore_polygon,
             validate_names,
         )
     }
 )
 
+ZONE_GROUP_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(ZoneGroup),
+            cv.Required(CONF_NAME): cv.string_strict,
+            cv.Required(CONF_ZONES): cv.All(
+                cv.ensure_list(cv.use_id(Zone)), cv.Length(min=1)
+            ),
+            cv.Optional(CONF_OCCUPANCY): binary_sensor.binary_sensor_schema(
+                device_class=DEVICE_CLASS_OCCUPANCY,
+            ).extend(cv.Schema({cv.Optional(CONF_NAME): cv.string_strict})),
+            cv.Optional(CONF_OCCUPIED_ZONES): sensor.sensor_schema(
+                accuracy_decimals=0,
+            ).extend(cv.Schema({cv.Optional(CONF_NAME): cv.string_strict})),
+        }
+    ),
+    validate_names,
+)
+
+ZONE_TRANSITION_SCHEMA = sensor.sensor_schema(
+    accuracy_decimals=0,
+    state_class=STATE_CLASS_TOTAL_INCREASING,
+).extend(
+    {
+        cv.Required(CONF_FROM): cv.use_id(Zone),
+        cv.Required(CONF_TO): cv.use_id(Zone),
+    }
+)
+
+
+def validate_grid(max_cells):
+    """Create a validator which asserts that a grid stays within a bounded amount of memory."""
+
+    def validator(config):
+        cell_size = round(config[CONF_CELL_SIZE] * 1000)
+        cells = (round(config[CONF_WIDTH] * 1000) // cell_size) * (
+            round(config[CONF_DEPTH] * 1000) // cell_size
+        )
+        if cells > max_cells:
+            raise cv.Invalid(
+                f"The grid would use {cells} cells, at most {max_cells} cells are supported. Increase the {CONF_CELL_SIZE}."
+            )
+        return config
+
+    return validator
+
+
+HEATMAP_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(Heatmap),
+            cv.Optional(CONF_WIDTH, default="6m"): cv.All(
+                cv.distance, cv.Range(min=0.1, max=12.0)
+            ),
+            cv.Optional(CONF_DEPTH, default="6m"): cv.All(
+                cv.distance, cv.Range(min=0.1, max=6.0)
+            ),
+            cv.Optional(CONF_X_MIN): cv.All(cv.distance, cv.Range(min=-12.0, max=12.0)),
+            cv.Optional(CONF_Y_MIN): cv.All(cv.distance, cv.Range(min=-12.0, max=12.0)),
+            cv.Optional(CONF_CELL_SIZE, default="20cm"): cv.All(
+                cv.distance, cv.Range(min=0.05, max=1.0)
+            ),
+        }
+    ),
+    validate_grid(4096),
+)
+
+
+def validate_mask_rectangle(config):
+    """Assert that the rectangle of a mask region has an area."""
+    if rectangle_config := config.get(CONF_RECTANGLE):
+        start, end = rectangle_config[CONF_START], rectangle_config[CONF_END]
+        if start[CONF_X] == end[CONF_X] or start[CONF_Y] == end[CONF_Y]:
+            raise cv.Invalid(
+                f"{CONF_START} and {CONF_END} of a rectangle must differ in both coordinates"
+            )
+    return config
+
+
+MASK_REGION_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.Optional(CONF_RECTANGLE): cv.Schema(
+                {
+                    cv.Required(CONF_START): cv.Schema(
+                        {
+                            cv.Required(CONF_X): cv.distance,
+                            cv.Required(CONF_Y): cv.distance,
+                        }
+                    ),
+                    cv.Required(CONF_END): cv.Schema(
+                        {
+                            cv.Required(CONF_X): cv.distance,
+                            cv.Required(CONF_Y): cv.distance,
+                        }
+                    ),
+                }
+            ),
+            cv.Optional(CONF_POLYGON): cv.All(
+                cv.ensure_list(POLYGON_SCHEMA), cv.Length(min=3)
+            ),
+        }
+    ),
+    cv.has_exactly_one_key(CONF_RECTANGLE, CONF_POLYGON),
+    validate_mask_rectangle,
+    validate_polygon,
+)
+
+INTERFERENCE_MASK_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(InterferenceMask),
+            cv.Optional(CONF_WIDTH, default="12m"): cv.All(
+                cv.distance, cv.Range(min=0.1, max=12.0)
+            ),
+            cv.Optional(CONF_DEPTH, default="6m"): cv.All(
+                cv.distance, cv.Range(min=0.1, max=6.0)
+            ),
+            cv.Optional(CONF_X_MIN): cv.All(cv.distance, cv.Range(min=-12.0, max=12.0)),
+            cv.Optional(CONF_Y_MIN): cv.All(cv.distance, cv.Range(min=-12.0, max=12.0)),
+            cv.Optional(CONF_CELL_SIZE, default="20cm"): cv.All(
+                cv.distance, cv.Range(min=0.05, max=1.0)
+            ),
+            cv.Optional(CONF_REGIONS, default=[]): cv.ensure_list(MASK_REGION_SCHEMA),
+            cv.Optional(CONF_LEARNING): cv.Schema(
+                {
+                    cv.Optional(
+                        CONF_STATIONARY_TIME, default="30min"
+                    ): cv.positive_time_period_milliseconds,
+                }
+            ),
+        }
+    ),
+    validate_grid(16384),
+)
+
+LATENCY_SENSOR_SCHEMA = sensor.sensor_schema(
+    unit_of_measurement=UNIT_MILLISECOND,
+    accuracy_decimals=1,
+    device_class=DEVICE_CLASS_DURATION,
+    state_class=STATE_CLASS_MEASUREMENT,
+    entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+)
+
+LATENCY_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(LatencyMonitor),
+        cv.Optional(CONF_QUEUE): LATENCY_SENSOR_SCHEMA,
+        cv.Optional(CONF_PROCESSING): LATENCY_SENSOR_SCHEMA,
+        cv.Optional(CONF_PUBLISH): LATENCY_SENSOR_SCHEMA,
+        cv.Optional(CONF_END_TO_END): LATENCY_SENSOR_SCHEMA,
+    }
+)
+
+TRACE_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(TraceBuffer),
+        cv.Optional(CONF_SIZE, default=128): cv.int_range(min=16, max=1024),
+    }
+)
+
+LINE_POINT_SCHEMA = cv.Schema(
+    {
+        cv.Required(CONF_X): cv.distance,
+        cv.Required(CONF_Y): cv.distance,
+    }
+)
+
+
+def validate_line(config):
+    """Assert that the end points of a crossing line differ."""
+    start, end = config[CONF_START], config[CONF_END]
+    if start[CONF_X] == end[CONF_X] and start[CONF_Y] == end[CONF_Y]:
+        raise cv.Invalid(f"{CONF_START} and {CONF_END} of a line must differ")
+    return config
+
+
+LINE_SCHEMA = cv.Schema(
+    {
+        cv.Required(CONF_LINE): cv.All(
+            {
+                cv.GenerateID(): cv.declare_id(CrossingLine),
+                cv.Required(CONF_NAME): cv.string_strict,
+                cv.Required(CONF_START): LINE_POINT_SCHEMA,
+                cv.Required(CONF_END): LINE_POINT_SCHEMA,
+                cv.Optional(CONF_RESTORE, default=True): cv.boolean,
+                cv.Optional(
+                    CONF_SAVE_INTERVAL, default="5min"
+                ): cv.positive_time_period_milliseconds,
+                cv.Optional(CONF_IN_COUNT): sensor.sensor_schema(
+                    accuracy_decimals=0,
+                    state_class=STATE_CLASS_TOTAL_INCREASING,
+                ),
+                cv.Optional(CONF_OUT_COUNT): sensor.sensor_schema(
+                    accuracy_decimals=0,
+                    state_class=STATE_CLASS_TOTAL_INCREASING,
+                ),
+            },
+            validate_line,
+        )
+    }
+)
+
 CONFIG_SCHEMA = cv.All(
     uart.UART_DEVICE_SCHEMA.extend(
         {
@@ -386,14 +922,74 @@ CONFIG_SCHEMA = cv.All(
                 cv.ensure_list(ZONE_SCHEMA),
                 cv.Length(min=1),
             ),
+            cv.Optional(CONF_ZONE_GROUPS): cv.All(
+                cv.ensure_list(ZONE_GROUP_SCHEMA),
+                cv.Length(min=1),
+            ),
+            cv.Optional(CONF_ZONE_TRANSITIONS): cv.All(
+                cv.ensure_list(ZONE_TRANSITION_SCHEMA),
+                cv.Length(min=1),
+            ),
+            cv.Optional(CONF_ZONE_STATISTICS_INTERVAL, default="60s"): cv.All(
+                cv.positive_time_period_milliseconds,
+                cv.Range(min=cv.TimePeriod(seconds=1)),
+            ),
+            cv.Optional(CONF_HEATMAP): HEATMAP_SCHEMA,
+            cv.Optional(CONF_INTERFERENCE_MASK): INTERFERENCE_MASK_SCHEMA,
+            cv.Optional(CONF_LATENCY): LATENCY_SCHEMA,
+            cv.Optional(CONF_TRACE): TRACE_SCHEMA,
+            cv.Optional(CONF_LINES): cv.All(
+                cv.ensure_list(LINE_SCHEMA),
+                cv.Length(min=1),
+            ),
             cv.Optional(CONF_FLIP_X_AXIS, default=False): cv.boolean,
+            cv.Optional(CONF_MOUNTING_POSE): cv.Schema(
+                {
+                    cv.Optional(CONF_X, default="0m"): cv.All(
+                        cv.distance, cv.Range(min=-20.0, max=20.0)
+                    ),
+                    cv.Optional(CONF_Y, default="0m"): cv.All(
+                        cv.distance, cv.Range(min=-20.0, max=20.0)
+                    ),
+                    cv.Optional(CONF_ROTATION, default="0°"): cv.All(
+                        cv.angle, cv.Range(min=-180.0, max=180.0)
+                    ),
+                }
+            ),
             cv.Optional(CONF_USE_FAST_OFF, default=False): cv.boolean,
+            cv.Optional(CONF_DECODE_TASK, default=False): cv.boolean,
+            cv.Optional(CONF_AUTO_BAUD_RATE): cv.Schema(
+                {
+                    cv.Optional(CONF_UPGRADE, default=False): cv.boolean,
+                }
+            ),
+            cv.Optional(CONF_MAX_PUBLISH_RATE, default=0): cv.int_range(
+                min=0, max=1000
+            ),
+            cv.Optional(CONF_TARGET_ASSOCIATION, default=False): cv.boolean,
+            cv.Optional(CONF_ASSOCIATION_GATE, default="1m"): cv.All(
+                cv.distance, cv.Range(min=0.0, max=6.0)
+            ),
+            cv.Optional(CONF_PREDICTION): PREDICTION_SCHEMA,
             cv.Optional(CONF_OCCUPANCY): binary_sensor.binary_sensor_schema(
                 device_class=DEVICE_CLASS_OCCUPANCY
             ),
             cv.Optional(CONF_TARGET_COUNT): sensor.sensor_schema(
                 accuracy_decimals=0,
             ),
+            cv.Optional(CONF_COLLAPSED_FRAMES): sensor.sensor_schema(
+                accuracy_decimals=0,
+                state_class=STATE_CLASS_TOTAL_INCREASING,
+                entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+            ),
+            cv.Optional(CONF_TIME_TO_FIRST_OCCUPANCY): sensor.sensor_schema(
+                unit_of_measurement=UNIT_MILLISECOND,
+                accuracy_decimals=0,
+                device_class=DEVICE_CLASS_DURATION,
+                entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+            ),
+            cv.Optional(CONF_FAST_STARTUP, default=False): cv.boolean,
+            cv.Optional(CONF_CACHE_SETTINGS, default=False): cv.boolean,
             cv.Optional(CONF_MAX_DISTANCE_MARGIN, default="25cm"): cv.All(
                 cv.distance, cv.Range(min=0.0, max=6.0)
             ),
@@ -495,6 +1091,11 @@ CONFIG_SCHEMA = cv.All(
     ),
     validate_target_names,
     validate_min_max_angle,
+    validate_decode_task,
+    validate_auto_baud_rate,
+    validate_trace,
+    validate_zone_groups,
+    validate_zone_transitions,
 )
 
 
@@ -505,8 +1106,32 @@ def to_code(config):
     yield uart.register_uart_device(var, config)
 
     cg.add(var.set_name(config[CONF_NAME]))
+    cg.add(var.set_component_id(str(config[CONF_ID].id)))
     cg.add(var.set_flip_x_axis(config[CONF_FLIP_X_AXIS]))
+    if pose_config := config.get(CONF_MOUNTING_POSE):
+        cg.add(
+            var.set_mounting_pose(
+                pose_config[CONF_X], pose_config[CONF_Y], pose_config[CONF_ROTATION]
+            )
+        )
     cg.add(var.set_fast_off_detection(config[CONF_USE_FAST_OFF]))
+    cg.add(var.set_decode_task(config[CONF_DECODE_TASK]))
+    if CONF_AUTO_BAUD_RATE in config:
+        cg.add(var.set_auto_baud_rate(config[CONF_AUTO_BAUD_RATE][CONF_UPGRADE]))
+    cg.add(var.set_fast_startup(config[CONF_FAST_STARTUP]))
+    cg.add(var.set_cache_settings(config[CONF_CACHE_SETTINGS]))
+    cg.add(var.set_max_publish_rate(config[CONF_MAX_PUBLISH_RATE]))
+    cg.add(var.set_target_association(config[CONF_TARGET_ASSOCIATION]))
+    cg.add(var.set_association_gate(config[CONF_ASSOCIATION_GATE]))
+    if prediction_config := config.get(CONF_PREDICTION):
+        cg.add(
+            var.set_prediction(
+                prediction_config[CONF_ALPHA],
+                prediction_config[CONF_BETA],
+                prediction_config[CONF_MAX_COAST_FRAMES],
+                prediction_config[CONF_LOOKAHEAD],
+            )
+        )
     cg.add(var.set_max_distance_margin(config[CONF_MAX_DISTANCE_MARGIN]))
     cg.add(var.set_tilt_angle_margin(config[CONF_TILT_ANGLE_MARGIN]))
 
@@ -518,11 +1143,116 @@ def to_code(config):
             cg.add(var.register_target(target))
 
     # process zones list
-    if zones_config := config.get(CONF_ZONES):
-        # Register target on controller
-        for zone_config in zones_config:
-            zone = yield zone_to_code(zone_config[CONF_ZONE])
-            cg.add(var.register_zone(zone))
+    zones_config = config.get(CONF_ZONES, [])
+    for zone_config in zones_config:
+        zone = yield zone_to_code(zone_config[CONF_ZONE])
+        cg.add(var.register_zone(zone))
+
+    # Zone groups and transitions identify zones by their index within the zones list
+    zone_ids = [str(zone_config[CONF_ZONE][CONF_ID]) for zone_config in zones_config]
+
+    # process zone groups
+    if zone_groups_config := config.get(CONF_ZONE_GROUPS):
+        for zone_group_config in zone_groups_config:
+            zone_group = yield zone_group_to_code(zone_group_config, zone_ids)
+            cg.add(var.register_zone_group(zone_group))
+
+    # process zone transition sensors
+    cg.add(var.set_zone_statistics_interval(config[CONF_ZONE_STATISTICS_INTERVAL]))
+    if transitions_config := config.get(CONF_ZONE_TRANSITIONS):
+        for transition_config in transitions_config:
+            transition_sensor = yield sensor.new_sensor(transition_config)
+            cg.add(
+                var.add_transition_sensor(
+                    zone_ids.index(str(transition_config[CONF_FROM])),
+                    zone_ids.index(str(transition_config[CONF_TO])),
+                    transition_sensor,
+                )
+            )
+
+    # Add dwell heatmap if present
+    if heatmap_config := config.get(CONF_HEATMAP):
+        heatmap = cg.new_Pvariable(heatmap_config[CONF_ID])
+        cg.add(
+            heatmap.set_dimensions(
+                heatmap_config[CONF_WIDTH],
+                heatmap_config[CONF_DEPTH],
+                heatmap_config[CONF_CELL_SIZE],
+            )
+        )
+        if CONF_X_MIN in heatmap_config or CONF_Y_MIN in heatmap_config:
+            cg.add(
+                heatmap.set_origin(
+                    heatmap_config.get(CONF_X_MIN, -heatmap_config[CONF_WIDTH] / 2),
+                    heatmap_config.get(CONF_Y_MIN, 0),
+                )
+            )
+        cg.add(var.set_heatmap(heatmap))
+
+    # Add interference mask if present, regions are rasterized during setup
+    if mask_config := config.get(CONF_INTERFERENCE_MASK):
+        mask = cg.new_Pvariable(mask_config[CONF_ID])
+        cg.add(
+            mask.set_dimensions(
+                mask_config[CONF_WIDTH],
+                mask_config[CONF_DEPTH],
+                mask_config[CONF_CELL_SIZE],
+            )
+        )
+        if CONF_X_MIN in mask_config or CONF_Y_MIN in mask_config:
+            cg.add(
+                mask.set_origin(
+                    mask_config.get(CONF_X_MIN, -mask_config[CONF_WIDTH] / 2),
+                    mask_config.get(CONF_Y_MIN, 0),
+                )
+            )
+        for region_config in mask_config[CONF_REGIONS]:
+            cg.add(mask.add_region())
+            if rectangle_config := region_config.get(CONF_RECTANGLE):
+                start = rectangle_config[CONF_START]
+                end = rectangle_config[CONF_END]
+                points = [
+                    (start[CONF_X], start[CONF_Y]),
+                    (end[CONF_X], start[CONF_Y]),
+                    (end[CONF_X], end[CONF_Y]),
+                    (start[CONF_X], end[CONF_Y]),
+                ]
+            else:
+                points = [
+                    (point_config[CONF_POINT][CONF_X], point_config[CONF_POINT][CONF_Y])
+                    for point_config in region_config[CONF_POLYGON]
+                ]
+            for x, y in points:
+                cg.add(mask.append_point(float(x), float(y)))
+        if learning_config := mask_config.get(CONF_LEARNING):
+            cg.add(mask.set_learning(learning_config[CONF_STATIONARY_TIME]))
+        cg.add(var.set_interference_mask(mask))
+
+    # Add latency monitor if present
+    if latency_config := config.get(CONF_LATENCY):
+        monitor = cg.new_Pvariable(latency_config[CONF_ID])
+        for key, setter in (
+            (CONF_QUEUE, monitor.set_queue_sensor),
+            (CONF_PROCESSING, monitor.set_processing_sensor),
+            (CONF_PUBLISH, monitor.set_publish_sensor),
+            (CONF_END_TO_END, monitor.set_end_to_end_sensor),
+        ):
+            if sensor_config := latency_config.get(key):
+                latency_sensor = yield sensor.new_sensor(sensor_config)
+                cg.add(setter(latency_sensor))
+        cg.add(var.set_latency_monitor(monitor))
+
+    # Add trace if present
+    if trace_config := config.get(CONF_TRACE):
+        trace = cg.new_Pvariable(trace_config[CONF_ID])
+        cg.add(trace.set_size(trace_config[CONF_SIZE]))
+        cg.add(var.set_trace(trace))
+
+    # process crossing lines
+    if lines_config := config.get(CONF_LINES):
+        for line_config in lines_config:
+            line = yield line_to_code(line_config[CONF_LINE])
+            cg.add(var.register_crossing_line(line))
 
     # Add binary occupancy sensor if present
     if occupancy_config := config.get(CONF_OCCUPANCY):
@@ -536,6 +1266,18 @@ def to_code(config):
         target_count_sensor = yield sensor.new_sensor(target_count_config)
         cg.add(var.set_target_count_sensor(target_count_sensor))
 
+    # Add collapsed frames diagnostic sensor if present
+    if collapsed_frames_config := config.get(CONF_COLLAPSED_FRAMES):
+        collapsed_frames_sensor = yield sensor.new_sensor(collapsed_frames_config)
+        cg.add(var.set_collapsed_frames_sensor(collapsed_frames_sensor))
+
+    # Add startup latency diagnostic sensor if present
+    if time_to_first_occupancy_config := config.get(CONF_TIME_TO_FIRST_OCCUPANCY):
+        time_to_first_occupancy_sensor = yield sensor.new_sensor(
+            time_to_first_occupancy_config
+        )
+        cg.add(var.set_time_to_first_occupancy_sensor(time_to_first_occupancy_sensor))
+
     # Different configurations for limit number components
     limit_numbers = {
         CONF_MAX_DISTANCE: {
@@ -636,11 +1378,12 @@ def to_code(config):
 def target_to_code(config, user_index: int):
     """Code generation for targets within the target list."""
     target = cg.new_Pvariable(config[CONF_ID])
-    yield cg.register_component(target, config)
 
     # Generate name if not provided
     cg.add(target.set_name(config[CONF_NAME]))
     cg.add(target.set_debugging(config[CONF_DEBUG]))
+    # Distances are processed in mm
+    cg.add(target.set_stationary_threshold(config[CONF_STATIONARY_THRESHOLD] * 1000))
 
     for SENSOR in [
         CONF_X_SENSOR,
@@ -649,12 +1392,25 @@ def target_to_code(config, user_index: int):
         CONF_DISTANCE_RESOLUTION_SENSOR,
         CONF_ANGLE_SENSOR,
         CONF_DISTANCE_SENSOR,
+        CONF_HEADING_SENSOR,
+        CONF_RADIAL_VELOCITY_SENSOR,
     ]:
         if sensor_config := config.get(SENSOR):
 
             sensor_var = cg.new_Pvariable(sensor_config[CONF_ID])
-            yield cg.register_component(sensor_var, sensor_config)
             yield sensor.register_sensor(sensor_var, sensor_config)
+            cg.add(sensor_var.set_update_interval(sensor_config[CONF_UPDATE_INTERVAL]))
+
+            # Distances are processed in mm
+            deadband = sensor_config[CONF_DEADBAND]
+            if SENSOR in [
+                CONF_X_SENSOR,
+                CONF_Y_SENSOR,
+                CONF_DISTANCE_RESOLUTION_SENSOR,
+                CONF_DISTANCE_SENSOR,
+            ]:
+                deadband *= 1000
+            cg.add(sensor_var.set_deadband(deadband))
 
             if SENSOR == CONF_X_SENSOR:
                 cg.add(target.set_x_position_sensor(sensor_var))
@@ -668,6 +1424,16 @@ def target_to_code(config, user_index: int):
                 cg.add(target.set_angle_sensor(sensor_var))
             elif SENSOR == CONF_DISTANCE_SENSOR:
                 cg.add(target.set_distance_sensor(sensor_var))
+            elif SENSOR == CONF_HEADING_SENSOR:
+                cg.add(target.set_heading_sensor(sensor_var))
+            elif SENSOR == CONF_RADIAL_VELOCITY_SENSOR:
+                cg.add(target.set_radial_velocity_sensor(sensor_var))
+
+    if stationary_config := config.get(CONF_STATIONARY):
+        stationary_binary_sensor = yield binary_sensor.new_binary_sensor(
+            stationary_config
+        )
+        cg.add(target.set_stationary_binary_sensor(stationary_binary_sensor))
 
     return target
 
@@ -677,11 +1443,45 @@ def zone_to_code(config):
     zone = cg.new_Pvariable(config[CONF_ID])
 
     cg.add(zone.set_name(config[CONF_NAME]))
+    cg.add(zone.set_component_id(str(config[CONF_ID].id)))
     cg.add(zone.set_margin(config[CONF_MARGIN]))
     cg.add(zone.set_target_timeout(config[CONF_TARGET_TIMEOUT]))
+    cg.add(zone.set_on_delay(config[CONF_ON_DELAY]))
+    cg.add(zone.set_off_delay(config[CONF_OFF_DELAY]))
+    cg.add(zone.set_min_dwell(config[CONF_MIN_DWELL]))
+    cg.add(zone.set_restore_polygon(config[CONF_RESTORE_POLYGON]))
 
+    # Set up analytic shapes
+    if circle_config := config.get(CONF_CIRCLE):
+        cg.add(
+            zone.set_circle(
+                circle_config[CONF_CENTER][CONF_X],
+                circle_config[CONF_CENTER][CONF_Y],
+                circle_config[CONF_RADIUS],
+            )
+        )
+    elif ring_config := config.get(CONF_RING):
+        cg.add(
+            zone.set_ring(
+                ring_config[CONF_CENTER][CONF_X],
+                ring_config[CONF_CENTER][CONF_Y],
+                ring_config[CONF_INNER_RADIUS],
+                ring_config[CONF_OUTER_RADIUS],
+            )
+        )
+    elif sector_config := config.get(CONF_SECTOR):
+        cg.add(
+            zone.set_sector(
+                sector_config[CONF_CENTER][CONF_X],
+                sector_config[CONF_CENTER][CONF_Y],
+                sector_config[CONF_SECTOR_MIN_DISTANCE],
+                sector_config[CONF_SECTOR_MAX_DISTANCE],
+                sector_config[CONF_START_ANGLE],
+                sector_config[CONF_END_ANGLE],
+            )
+        )
     # Add points to the polygon of the zone object
-    if CONF_LAMBDA in config.get(CONF_POLYGON, []):
+    elif CONF_LAMBDA in config[CONF_POLYGON]:
         template_ = yield cg.process_lambda(
             config[CONF_POLYGON][CONF_LAMBDA],
             [],
@@ -715,9 +1515,162 @@ def zone_to_code(config):
         target_count_sensor = yield sensor.new_sensor(target_count_config)
         cg.add(zone.set_target_count_sensor(target_count_sensor))
 
+    # Add dwell time sensor if present
+    if dwell_time_config := config.get(CONF_DWELL_TIME):
+        dwell_time_sensor = yield sensor.new_sensor(dwell_time_config)
+        cg.add(zone.set_dwell_time_sensor(dwell_time_sensor))
+
+    # Add entry and exit automations, which provide the target index and the frame timestamp
+    for conf in config.get(CONF_ON_ENTER, []):
+        trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID])
+        cg.add(zone.add_on_enter_trigger(trigger))
+        yield automation.build_automation(
+            trigger, [(cg.uint8, "target"), (cg.uint32, "timestamp")], conf
+        )
+    for conf in config.get(CONF_ON_EXIT, []):
+        trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID])
+        cg.add(zone.add_on_exit_trigger(trigger))
+        yield automation.build_automation(
+            trigger, [(cg.uint8, "target"), (cg.uint32, "timestamp")], conf
+        )
+
     return zone
 
 
+def zone_group_to_code(config, zone_ids):
+    """Code generation for zone groups and their sub-sensors."""
+    zone_group = cg.new_Pvariable(config[CONF_ID])
+
+    cg.add(zone_group.set_name(config[CONF_NAME]))
+    for zone_id in config[CONF_ZONES]:
+        cg.add(zone_group.add_zone(zone_ids.index(str(zone_id))))
+
+    # Add binary occupancy sensor if present
+    if occupancy_config := config.get(CONF_OCCUPANCY):
+        occupancy_binary_sensor = yield binary_sensor.new_binary_sensor(
+            occupancy_config
+        )
+        cg.add(zone_group.set_occupancy_binary_sensor(occupancy_binary_sensor))
+
+    # Add occupied zones sensor if present
+    if occupied_zones_config := config.get(CONF_OCCUPIED_ZONES):
+        occupied_zones_sensor = yield sensor.new_sensor(occupied_zones_config)
+        cg.add(zone_group.set_occupied_zones_sensor(occupied_zones_sensor))
+
+    return zone_group
+
+
+def line_to_code(config):
+    """Code generation for crossing lines and their sub-sensors."""
+    line = cg.new_Pvariable(config[CONF_ID])
+
+    cg.add(line.set_name(config[CONF_NAME]))
+    cg.add(line.set_component_id(str(config[CONF_ID].id)))
+    cg.add(
+        line.set_line(
+            config[CONF_START][CONF_X],
+            config[CONF_START][CONF_Y],
+            config[CONF_END][CONF_X],
+            config[CONF_END][CONF_Y],
+        )
+    )
+    cg.add(line.set_restore(config[CONF_RESTORE]))
+    cg.add(line.set_save_interval(config[CONF_SAVE_INTERVAL]))
+
+    # Add counter sensors if present
+    if in_count_config := config.get(CONF_IN_COUNT):
+        in_count_sensor = yield sensor.new_sensor(in_count_config)
+        cg.add(line.set_in_count_sensor(in_count_sensor))
+    if out_count_config := config.get(CONF_OUT_COUNT):
+        out_count_sensor = yield sensor.new_sensor(out_count_config)
+        cg.add(line.set_out_count_sensor(out_count_sensor))
+
+    return line
+
+
+@automation.register_action(
+    "LD2450.line.reset",
+    ResetCrossingLineAction,
+    automation.maybe_simple_id(
+        {
+            cv.Required(CONF_ID): cv.use_id(CrossingLine),
+        }
+    ),
+)
+async def reset_line_to_code(config, action_id, template_arg, args):
+    """Code generation for the crossing line reset action."""
+    parent = await cg.get_variable(config[CONF_ID])
+    return cg.new_Pvariable(action_id, template_arg, parent)
+
+
+HEATMAP_ACTION_SCHEMA = automation.maybe_simple_id(
+    {
+        cv.Required(CONF_ID): cv.use_id(Heatmap),
+    }
+)
+
+
+@automation.register_action(
+    "LD2450.heatmap.dump", DumpHeatmapAction, HEATMAP_ACTION_SCHEMA
+)
+@automation.register_action(
+    "LD2450.heatmap.reset", ResetHeatmapAction, HEATMAP_ACTION_SCHEMA
+)
+async def heatmap_action_to_code(config, action_id, template_arg, args):
+    """Code generation for the heatmap dump and reset actions."""
+    parent = await cg.get_variable(config[CONF_ID])
+    return cg.new_Pvariable(action_id, template_arg, parent)
+
+
+LATENCY_ACTION_SCHEMA = automation.maybe_simple_id(
+    {
+        cv.Required(CONF_ID): cv.use_id(LatencyMonitor),
+    }
+)
+
+
+@automation.register_action(
+    "LD2450.latency.dump", DumpLatencyAction, LATENCY_ACTION_SCHEMA
+)
+@automation.register_action(
+    "LD2450.latency.reset", ResetLatencyAction, LATENCY_ACTION_SCHEMA
+)
+async def latency_action_to_code(config, action_id, template_arg, args):
+    """Code generation for the latency dump and reset actions."""
+    parent = await cg.get_variable(config[CONF_ID])
+    return cg.new_Pvariable(action_id, template_arg, parent)
+
+
+TRACE_ACTION_SCHEMA = automation.maybe_simple_id(
+    {
+        cv.Required(CONF_ID): cv.use_id(TraceBuffer),
+    }
+)
+
+
+@automation.register_action("LD2450.trace.dump", DumpTraceAction, TRACE_ACTION_SCHEMA)
+@automation.register_action("LD2450.trace.clear", ClearTraceAction, TRACE_ACTION_SCHEMA)
+async def trace_action_to_code(config, action_id, template_arg, args):
+    """Code generation for the trace dump and clear actions."""
+    parent = await cg.get_variable(config[CONF_ID])
+    return cg.new_Pvariable(action_id, template_arg, parent)
+
+
+@automation.register_action(
+    "LD2450.interference_mask.clear_learned",
+    ClearLearnedMaskAction,
+    automation.maybe_simple_id(
+        {
+            cv.Required(CONF_ID): cv.use_id(InterferenceMask),
+        }
+    ),
+)
+async def clear_learned_mask_to_code(config, action_id, template_arg, args):
+    """Code generation for the clear learned mask action."""
+    parent = await cg.get_variable(config[CONF_ID])
+    return cg.new_Pvariable(action_id, template_arg, parent)
+
+
 @automation.register_action(
     "LD2450.zone.update_polygon",
     UpdatePolygonAction,
@@ -725,6 +1678,7 @@ def zone_to_code(config):
         {
             cv.Required(CONF_ID): cv.use_id(Zone),
             cv.Required(CONF_POLYGON): cv.templatable(cv.ensure_list(Point)),
+            cv.Optional(CONF_PERSIST, default=False): cv.templatable(cv.boolean),
         }
     ),
 )
@@ -737,4 +1691,7 @@ async def update_polygon_to_code(config, action_id, template_arg, args):
         config[CONF_POLYGON], args, cg.std_vector.template(Point)
     )
     cg.add(var.set_polygon(template_))
+
+    persist_ = await cg.templatable(config[CONF_PERSIST], args, bool)
+    cg.add(var.set_persist(persist_))
     return var
@@ -0,0 +1,45 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include "esphome/core/log.h"
+
+#define BASE64_DUMP_CHUNK_SIZE 48
+
+namespace esphome::ld2450
+{
+    static const char BASE64_CHARS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    /**
+     * @brief Writes binary data to the log as numbered chunks of base64 encoded data ("<prefix> <offset> <data>"), followed by "<prefix> END".
+     * The data is read byte by byte, such that ring buffers and arrays of wider types are encoded in place without a copy or allocation.
+     * @param tag log tag
+     * @param prefix prefix of each line, which identifies the dump for the decoding tools
+     * @param size number of bytes
+     * @param byte_at callable which returns the byte at an index (0 to size - 1)
+     */
+    template <typename ByteAt>
+    void chunked_base64_dump(const char *tag, const char *prefix, size_t size, ByteAt byte_at)
+    {
+        char line[BASE64_DUMP_CHUNK_SIZE / 3 * 4 + 1];
+        for (size_t offset = 0; offset < size; offset += BASE64_DUMP_CHUNK_SIZE)
+        {
+            size_t length = std::min<size_t>(BASE64_DUMP_CHUNK_SIZE, size - offset);
+            size_t position = 0;
+            for (size_t i = 0; i < length; i += 3)
+            {
+                uint8_t bytes[3] = {0, 0, 0};
+                for (size_t j = 0; j < 3 && i + j < length; j++)
+                    bytes[j] = byte_at(offset + i + j);
+                uint32_t triple = bytes[0] << 16 | bytes[1] << 8 | bytes[2];
+                line[position++] = BASE64_CHARS[(triple >> 18) & 0x3F];
+                line[position++] = BASE64_CHARS[(triple >> 12) & 0x3F];
+                line[position++] = i + 1 < length ? BASE64_CHARS[(triple >> 6) & 0x3F] : '=';
+                line[position++] = i + 2 < length ? BASE64_CHARS[triple & 0x3F] : '=';
+            }
+            line[position] = '\0';
+            ESP_LOGI(tag, "%s %04X %s", prefix, unsigned(offset), line);
+        }
+        ESP_LOGI(tag, "%s END", prefix);
+    }
+} // namespace esphome::ld2450
@@ -0,0 +1,132 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+
+// Startup reads (3), the two largest user actions (4 each), enter and leave config (1 each) need 13 slots
+#define COMMAND_QUEUE_SIZE 16
+#define COMMAND_MAX_LENGTH 8
+
+namespace esphome::ld2450
+{
+    /**
+     * @brief Config command (without frame header, length and end) which is sent to the sensor.
+     */
+    struct Command
+    {
+        /// @brief Command word followed by the command value
+        uint8_t data[COMMAND_MAX_LENGTH];
+
+        /// @brief Number of used bytes
+        uint8_t length;
+    };
+
+    /**
+     * @brief Double-ended ring of pending config commands with a fixed capacity, such that queueing commands does not allocate.
+     */
+    class CommandQueue
+    {
+    public:
+        /**
+         * @brief Appends a command to the end of the queue.
+         * @param data command buffer
+         * @param length command length, at most COMMAND_MAX_LENGTH
+         * @return false if the queue is full or the command too long, the command is discarded
+         */
+        bool push_back(const uint8_t *data, uint8_t length)
+        {
+            if (count_ == COMMAND_QUEUE_SIZE || length > COMMAND_MAX_LENGTH)
+                return false;
+            store((head_ + count_) % COMMAND_QUEUE_SIZE, data, length);
+            count_++;
+            return true;
+        }
+
+        /**
+         * @brief Inserts a command at the front of the queue.
+         * @param data command buffer
+         * @param length command length, at most COMMAND_MAX_LENGTH
+         * @return false if the queue is full or the command too long, the command is discarded
+         */
+        bool push_front(const uint8_t *data, uint8_t length)
+        {
+            if (count_ == COMMAND_QUEUE_SIZE || length > COMMAND_MAX_LENGTH)
+                return false;
+            head_ = (head_ + COMMAND_QUEUE_SIZE - 1) % COMMAND_QUEUE_SIZE;
+            store(head_, data, length);
+            count_++;
+            return true;
+        }
+
+        /**
+         * @brief Removes the first command, if any.
+         */
+        void pop_front()
+        {
+            if (count_ == 0)
+                return;
+            head_ = (head_ + 1) % COMMAND_QUEUE_SIZE;
+            count_--;
+        }
+
+        /**
+         * @brief Gets the first command. Must not be called on an empty queue.
+         */
+        const Command &front() const
+        {
+            return commands_[head_];
+        }
+
+        /**
+         * @brief Gets the command word of the first command.
+         * @return command word, 0 if the queue is empty
+         */
+        uint8_t front_word() const
+        {
+            return count_ > 0 ? commands_[head_].data[0] : 0;
+        }
+
+        /**
+         * @brief Removes all commands.
+         */
+        void clear()
+        {
+            head_ = 0;
+            count_ = 0;
+        }
+
+        /**
+         * @brief Number of queued commands.
+         */
+        uint8_t size() const
+        {
+            return count_;
+        }
+
+        /**
+         * @brief Determines whether no commands are queued.
+         */
+        bool empty() const
+        {
+            return count_ == 0;
+        }
+
+    protected:
+        /**
+         * @brief Copies a command into a slot.
+         */
+        void store(uint8_t index, const uint8_t *data, uint8_t length)
+        {
+            memcpy(commands_[index].data, data, length);
+            commands_[index].length = length;
+        }
+
+        /// @brief Command storage
+        Command commands_[COMMAND_QUEUE_SIZE];
+
+        /// @brief Index of the first command
+        uint8_t head_ = 0;
+
+        /// @brief Number of queued commands
+        uint8_t count_ = 0;
+    };
+} // namespace esphome::ld2450
@@ -0,0 +1,101 @@
+#include "crossing_line.h"
+
+namespace esphome::ld2450
+{
+    static const char *TAG = "CrossingLine";
+
+    void CrossingLine::setup()
+    {
+        if (!restore_)
+            return;
+
+        // Lines of several sensors may share their name, hence the key is derived from the id of the line
+        pref_ = global_preferences->make_preference<CrossingCounts>(fnv1_hash(std::string("LD2450 line ") + (component_id_ != nullptr ? component_id_ : name_)));
+        CrossingCounts counts;
+        if (pref_.load(&counts))
+            counts_ = counts;
+        last_save_ = millis();
+    }
+
+    void CrossingLine::dump_config()
+    {
+        ESP_LOGCONFIG(TAG, "Crossing line: %s", name_);
+        ESP_LOGCONFIG(TAG, "  line: (%i, %i) - (%i, %i) mm", start_.x, start_.y, end_.x, end_.y);
+        ESP_LOGCONFIG(TAG, "  restore: %s", restore_ ? "true" : "false");
+        if (restore_)
+            ESP_LOGCONFIG(TAG, "  save_interval: %i", int(save_interval_));
+#ifdef USE_SENSOR
+        LOG_SENSOR("  ", "InCountSensor", in_count_sensor_);
+        LOG_SENSOR("  ", "OutCountSensor", out_count_sensor_);
+#endif
+    }
+
+    void CrossingLine::update(Target *target)
+    {
+        int16_t x, y;
+        if (!target->get_previous_position(x, y))
+            return;
+        Point previous(x, y);
+        Point current(target->get_x(), target->get_y());
+
+        // Sides are half-open (points on the line belong to the right side), such that touching the line is not counted twice
+        bool previous_left = orientation(start_, end_, previous) > 0;
+        bool current_left = orientation(start_, end_, current) > 0;
+        if (previous_left == current_left)
+            return;
+
+        // The movement only crosses the line segment, if the end points of the segment are on different sides of the movement
+        int64_t start_side = orientation(previous, current, start_);
+        int64_t end_side = orientation(previous, current, end_);
+        if ((start_side > 0 && end_side > 0) || (start_side < 0 && end_side < 0))
+            return;
+
+        if (current_left)
+            counts_.in++;
+        else
+            counts_.out++;
+        dirty_ = true;
+    }
+
+    void CrossingLine::commit(int &publishes, int &unchanged)
+    {
+#ifdef USE_SENSOR
+        if (in_count_sensor_ != nullptr)
+        {
+            if (initial_commit_ || committed_counts_.in != counts_.in)
+            {
+                in_count_sensor_->publish_state(counts_.in);
+                publishes++;
+            }
+            else
+            {
+                unchanged++;
+            }
+        }
+        if (out_count_sensor_ != nullptr)
+        {
+            if (initial_commit_ || committed_counts_.out != counts_.out)
+            {
+                out_count_sensor_->publish_state(counts_.out);
+                publishes++;
+            }
+            else
+            {
+                unchanged++;
+            }
+        }
+#endif
+        committed_counts_ = counts_;
+        initial_commit_ = false;
+    }
+
+    void CrossingLine::save(bool force)
+    {
+        if (!restore_ || !dirty_ || (!force && millis() - last_save_ < save_interval_))
+            return;
+
+        pref_.save(&counts_);
+        dirty_ = false;
+        last_save_ = millis();
+    }
+} // namespace esphome::ld2450
@@ -0,0 +1,199 @@
+#pragma once
+#include "esphome/core/automation.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/preferences.h"
+#include "target.h"
+#include "zone.h"
+#ifdef USE_SENSOR
+#include "esphome/components/sensor/sensor.h"
+#endif
+
+namespace esphome::ld2450
+{
+    /**
+     * @brief Persisted counters of a crossing line.
+     */
+    struct CrossingCounts
+    {
+        uint32_t in;
+        uint32_t out;
+    };
+
+    /**
+     * @brief Virtual line segment which counts directional crossings of targets (e.g. people passing a doorway).
+     * Crossings from the right to the left side of the line (seen from start to end) are counted as "in", crossings in the opposite direction as "out".
+     */
+    class CrossingLine
+    {
+#ifdef USE_SENSOR
+        SUB_SENSOR(in_count)
+        SUB_SENSOR(out_count)
+#endif
+    public:
+        /**
+         * @brief Update the name of this line.
+         * @param name new name
+         */
+        void set_name(const char *name)
+        {
+            name_ = name;
+        }
+
+        /**
+         * @brief Sets the id of this line, which is unique across all sensors unlike the name and identifies its preferences.
+         * @param id id of the line within the configuration
+         */
+        void set_component_id(const char *id)
+        {
+            component_id_ = id;
+        }
+
+        /**
+         * @brief Sets the end points of this line.
+         * @param start_x x coordinate of the start point in m
+         * @param start_y y coordinate of the start point in m
+         * @param end_x x coordinate of the end point in m
+         * @param end_y y coordinate of the end point in m
+         */
+        void set_line(float start_x, float start_y, float end_x, float end_y)
+        {
+            start_ = Point(int(start_x * 1000), int(start_y * 1000));
+            end_ = Point(int(end_x * 1000), int(end_y * 1000));
+        }
+
+        /**
+         * @brief Enables restoring the counters after a reboot.
+         * @param restore true if counters should be persisted
+         */
+        void set_restore(bool restore)
+        {
+            restore_ = restore;
+        }
+
+        /**
+         * @brief Sets the minimum time between two writes of the persisted counters.
+         * @param interval time in ms
+         */
+        void set_save_interval(uint32_t interval)
+        {
+            save_interval_ = interval;
+        }
+
+        /**
+         * @brief Restores persisted counters.
+         */
+        void setup();
+
+        /**
+         * Logs the line configuration.
+         */
+        void dump_config();
+
+        /**
+         * @brief Checks whether a target crossed this line during its last update. Must be called once per target update.
+         * @param target target which was just updated
+         */
+        void update(Target *target);
+
+        /**
+         * @brief Publishes the counters, but only if they have changed since the last commit.
+         * @param publishes incremented by the number of publish calls
+         * @param unchanged incremented by the number of sensors which were not published
+         */
+        void commit(int &publishes, int &unchanged);
+
+        /**
+         * @brief Persists the counters if they have changed and the save interval has passed.
+         * @param force true to ignore the save interval (i.e. before shutting down)
+         */
+        void save(bool force = false);
+
+        /**
+         * @brief Resets both counters to 0.
+         */
+        void reset()
+        {
+            counts_ = {0, 0};
+            dirty_ = true;
+        }
+
+        /**
+         * @brief Gets the number of crossings in "in" direction.
+         */
+        uint32_t get_in_count()
+        {
+            return counts_.in;
+        }
+
+        /**
+         * @brief Gets the number of crossings in "out" direction.
+         */
+        uint32_t get_out_count()
+        {
+            return counts_.out;
+        }
+
+    protected:
+        /**
+         * @brief Computes the orientation of a point in relation to the segment a-b.
+         * @return positive if the point lies on the left side, negative on the right and 0 on the line
+         */
+        static int64_t orientation(Point a, Point b, Point point)
+        {
+            return int64_t(b.x - a.x) * (point.y - a.y) - int64_t(b.y - a.y) * (point.x - a.x);
+        }
+
+        /// @brief Name of this line
+        const char *name_ = "Unnamed Line";
+
+        /// @brief Id of this line, the name is used for preference keys if not set
+        const char *component_id_ = nullptr;
+
+        /// @brief Start point of the line in mm
+        Point start_{};
+
+        /// @brief End point of the line in mm
+        Point end_{};
+
+        /// @brief Current counters
+        CrossingCounts counts_{0, 0};
+
+        /// @brief Counters which were last published
+        CrossingCounts committed_counts_{0, 0};
+
+        /// @brief True until the counters have been published once
+        bool initial_commit_ = true;
+
+        /// @brief Determines whether counters are persisted
+        bool restore_ = false;
+
+        /// @brief True if the counters changed since the last save
+        bool dirty_ = false;
+
+        /// @brief Minimum time between two writes in ms
+        uint32_t save_interval_ = 300000;
+
+        /// @brief Timestamp of the last write
+        uint32_t last_save_ = 0;
+
+        /// @brief Preference object used for persisting the counters
+        ESPPreferenceObject pref_;
+    };
+
+    template <typename... Ts>
+    class ResetCrossingLineAction : public Action<Ts...>
+    {
+    public:
+        ResetCrossingLineAction(CrossingLine *parent)
+            : parent_(parent)
+        {
+        }
+
+        void play(const Ts &...x) override
+        {
+            this->parent_->reset();
+        }
+
+        CrossingLine *parent_;
+    };
+} // namespace esphome::ld2450
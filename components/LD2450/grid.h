@@ -0,0 +1,126 @@
+#pragma once
+#include <cmath>
+#include <cstdint>
+#include "zone.h"
+
+namespace esphome::ld2450
+{
+    /**
+     * @brief Geometry of a regular grid of square cells over the field of view of the sensor.
+     * By default, the grid is centered on the sensor along the x-axis and starts at the sensor along the y-axis. The origin can be moved for room coordinates. Cells are numbered row-wise.
+     */
+    class Grid
+    {
+    public:
+        /**
+         * @brief Sets the covered area and the resolution of the grid.
+         * @param width width of the area along the x-axis in m, centered on the sensor
+         * @param depth depth of the area along the y-axis in m
+         * @param cell_size edge length of a cell in m
+         */
+        void set_dimensions(float width, float depth, float cell_size)
+        {
+            cell_size_ = lroundf(cell_size * 1000);
+            columns_ = lroundf(width * 1000) / cell_size_;
+            rows_ = lroundf(depth * 1000) / cell_size_;
+            x_min_ = -(columns_ * cell_size_) / 2;
+            y_min_ = 0;
+        }
+
+        /**
+         * @brief Moves the corner of the grid with the lowest coordinates. Must be called after set_dimensions().
+         * @param x_min lowest x coordinate covered by the grid in m
+         * @param y_min lowest y coordinate covered by the grid in m
+         */
+        void set_origin(float x_min, float y_min)
+        {
+            x_min_ = lroundf(x_min * 1000);
+            y_min_ = lroundf(y_min * 1000);
+        }
+
+        /**
+         * @brief Gets the index of the cell which contains a point.
+         * @param x x coordinate in mm
+         * @param y y coordinate in mm
+         * @return cell index or -1 if the point is outside of the grid
+         */
+        int32_t cell_index(int32_t x, int32_t y) const
+        {
+            x -= x_min_;
+            y -= y_min_;
+            if (x < 0 || y < 0)
+                return -1;
+            int32_t column = x / cell_size_;
+            int32_t row = y / cell_size_;
+            if (column >= columns_ || row >= rows_)
+                return -1;
+            return row * columns_ + column;
+        }
+
+        /**
+         * @brief Gets the center of a cell.
+         * @param index cell index
+         * @return center of the cell in mm
+         */
+        Point cell_center(int32_t index) const
+        {
+            int32_t column = index % columns_;
+            int32_t row = index / columns_;
+            return Point(x_min_ + column * cell_size_ + cell_size_ / 2, y_min_ + row * cell_size_ + cell_size_ / 2);
+        }
+
+        /**
+         * @brief Gets the number of cells of this grid.
+         */
+        size_t size() const
+        {
+            return columns_ * rows_;
+        }
+
+        /// @brief Gets the number of cells along the x-axis.
+        int32_t get_columns() const
+        {
+            return columns_;
+        }
+
+        /// @brief Gets the number of cells along the y-axis.
+        int32_t get_rows() const
+        {
+            return rows_;
+        }
+
+        /// @brief Gets the edge length of a cell in mm.
+        int32_t get_cell_size() const
+        {
+            return cell_size_;
+        }
+
+        /// @brief Gets the lowest x coordinate covered by the grid in mm.
+        int32_t get_x_min() const
+        {
+            return x_min_;
+        }
+
+        /// @brief Gets the lowest y coordinate covered by the grid in mm.
+        int32_t get_y_min() const
+        {
+            return y_min_;
+        }
+
+    protected:
+        /// @brief Edge length of a cell in mm
+        int32_t cell_size_ = 200;
+
+        /// @brief Number of cells along the x-axis
+        int32_t columns_ = 30;
+
+        /// @brief Number of cells along the y-axis
+        int32_t rows_ = 30;
+
+        /// @brief Lowest x coordinate covered by the grid in mm
+        int32_t x_min_ = -3000;
+
+        /// @brief Lowest y coordinate covered by the grid in mm
+        int32_t y_min_ = 0;
+    };
+} // namespace esphome::ld2450
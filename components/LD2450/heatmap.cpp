@@ -0,0 +1,25 @@
+#include "base64_dump.h"
+#include "heatmap.h"
+
+namespace esphome::ld2450
+{
+    static const char *TAG = "Heatmap";
+
+    void Heatmap::dump_config()
+    {
+        ESP_LOGCONFIG(TAG, "Heatmap:");
+        ESP_LOGCONFIG(TAG, "  grid: %i x %i cells", int(grid_.get_columns()), int(grid_.get_rows()));
+        ESP_LOGCONFIG(TAG, "  cell_size: %i mm", int(grid_.get_cell_size()));
+        ESP_LOGCONFIG(TAG, "  origin: (%i, %i) mm", int(grid_.get_x_min()), int(grid_.get_y_min()));
+    }
+
+    void Heatmap::dump()
+    {
+        // Header: columns, rows, cell size and origin, followed by numbered chunks of base64 encoded cell data
+        ESP_LOGI(TAG, "HEATMAP %i %i %i %i %i", int(grid_.get_columns()), int(grid_.get_rows()), int(grid_.get_cell_size()), int(grid_.get_x_min()), int(grid_.get_y_min()));
+
+        // Little endian bytes of the cell array
+        chunked_base64_dump(TAG, "HEATMAP", cells_.size() * 2, [this](size_t index) -> uint8_t
+                            { return (index & 1) ? cells_[index / 2] >> 8 : cells_[index / 2] & 0xFF; });
+    }
+} // namespace esphome::ld2450
@@ -0,0 +1,136 @@
+#pragma once
+#include <algorithm>
+#include "esphome/core/automation.h"
+#include "esphome/core/hal.h"
+#include "target.h"
+#include "grid.h"
+
+namespace esphome::ld2450
+{
+    /**
+     * @brief Fixed resolution dwell heatmap over the field of view of the sensor.
+     * Each cell counts the number of frames in which a target was located inside of the cell, using saturating 16 bit counters.
+     */
+    class Heatmap
+    {
+    public:
+        /**
+         * @brief Sets the covered area and the resolution of the heatmap.
+         * @param width width of the area along the x-axis in m, centered on the sensor
+         * @param depth depth of the area along the y-axis in m
+         * @param cell_size edge length of a cell in m
+         */
+        void set_dimensions(float width, float depth, float cell_size)
+        {
+            grid_.set_dimensions(width, depth, cell_size);
+        }
+
+        /**
+         * @brief Moves the corner of the covered area with the lowest coordinates.
+         * @param x_min lowest x coordinate in m
+         * @param y_min lowest y coordinate in m
+         */
+        void set_origin(float x_min, float y_min)
+        {
+            grid_.set_origin(x_min, y_min);
+        }
+
+        /**
+         * @brief Allocates the grid. The grid is never resized afterwards.
+         */
+        void setup()
+        {
+            cells_.assign(grid_.size(), 0);
+        }
+
+        /**
+         * Logs the heatmap configuration.
+         */
+        void dump_config();
+
+        /**
+         * @brief Accounts the current position of a present target.
+         * @param target target to account
+         */
+        void update(Target *target)
+        {
+            if (!target->is_present())
+                return;
+
+            int32_t index = grid_.cell_index(target->get_x(), target->get_y());
+            if (index < 0)
+                return;
+
+            uint16_t &cell = cells_[index];
+            if (cell != UINT16_MAX)
+                cell++;
+        }
+
+        /**
+         * @brief Resets all cells to 0.
+         */
+        void reset()
+        {
+            std::fill(cells_.begin(), cells_.end(), 0);
+        }
+
+        /**
+         * @brief Logs the grid as base64 encoded little endian 16 bit values, which can be rendered by tools/render_heatmap.py.
+         */
+        void dump();
+
+        /**
+         * @brief Gets the counter of a single cell.
+         * @param column column index, starting at the lowest x coordinate
+         * @param row row index, starting at the lowest y coordinate
+         * @return number of frames in which a target was located in this cell
+         */
+        uint16_t get_cell(uint16_t column, uint16_t row)
+        {
+            if (column >= grid_.get_columns() || row >= grid_.get_rows())
+                return 0;
+            return cells_[row * grid_.get_columns() + column];
+        }
+
+    protected:
+        /// @brief Geometry of the heatmap
+        Grid grid_;
+
+        /// @brief Cell counters, stored row-wise starting at the lowest y coordinate
+        std::vector<uint16_t> cells_{};
+    };
+
+    template <typename... Ts>
+    class DumpHeatmapAction : public Action<Ts...>
+    {
+    public:
+        DumpHeatmapAction(Heatmap *parent)
+            : parent_(parent)
+        {
+        }
+
+        void play(const Ts &...x) override
+        {
+            this->parent_->dump();
+        }
+
+        Heatmap *parent_;
+    };
+
+    template <typename... Ts>
+    class ResetHeatmapAction : public Action<Ts...>
+    {
+    public:
+        ResetHeatmapAction(Heatmap *parent)
+            : parent_(parent)
+        {
+        }
+
+        void play(const Ts &...x) override
+        {
+            this->parent_->reset();
+        }
+
+        Heatmap *parent_;
+    };
+} // namespace esphome::ld2450
@@ -0,0 +1,78 @@
+#include "interference_mask.h"
+
+namespace esphome::ld2450
+{
+    static const char *TAG = "InterferenceMask";
+
+    void InterferenceMask::setup()
+    {
+        size_t words = (grid_.size() + 31) / 32;
+        static_cells_.assign(words, 0);
+        learned_cells_.assign(words, 0);
+
+        // A cell is masked if its center is located inside of a (convex) region
+        for (size_t index = 0; index < grid_.size(); index++)
+        {
+            Point center = grid_.cell_center(index);
+            for (const std::vector<Point> &region : regions_)
+            {
+                bool has_positive = false, has_negative = false;
+                size_t size = region.size();
+                for (size_t i = 0; i < size; i++)
+                {
+                    const Point &a = region[i];
+                    const Point &b = region[(i + 1) % size];
+                    int64_t cross_product = int64_t(b.x - a.x) * (center.y - a.y) - int64_t(b.y - a.y) * (center.x - a.x);
+                    has_positive |= cross_product > 0;
+                    has_negative |= cross_product < 0;
+                }
+                if (!(has_positive && has_negative))
+                {
+                    set(static_cells_, index);
+                    break;
+                }
+            }
+        }
+
+        // The regions are no longer required
+        regions_.clear();
+        regions_.shrink_to_fit();
+    }
+
+    void InterferenceMask::dump_config()
+    {
+        int masked = 0;
+        for (size_t index = 0; index < grid_.size(); index++)
+            masked += test(static_cells_, index);
+
+        ESP_LOGCONFIG(TAG, "Interference mask:");
+        ESP_LOGCONFIG(TAG, "  grid: %i x %i cells", int(grid_.get_columns()), int(grid_.get_rows()));
+        ESP_LOGCONFIG(TAG, "  cell_size: %i mm", int(grid_.get_cell_size()));
+        ESP_LOGCONFIG(TAG, "  origin: (%i, %i) mm", int(grid_.get_x_min()), int(grid_.get_y_min()));
+        ESP_LOGCONFIG(TAG, "  masked cells: %i", masked);
+        if (learning_)
+            ESP_LOGCONFIG(TAG, "  learning stationary time: %i ms", int(stationary_time_));
+    }
+
+    void InterferenceMask::observe(uint8_t slot, int16_t x, int16_t y, int16_t speed, int16_t resolution, uint32_t timestamp)
+    {
+        if (!learning_ || slot >= 3)
+            return;
+
+        int32_t index = resolution != 0 && speed == 0 ? grid_.cell_index(x, y) : -1;
+        if (index != stationary_cell_[slot])
+        {
+            // Restart the stationary time whenever the target moves or leaves its cell
+            stationary_cell_[slot] = index;
+            stationary_since_[slot] = timestamp;
+            return;
+        }
+
+        if (index >= 0 && timestamp - stationary_since_[slot] >= stationary_time_ && !test(learned_cells_, index) && !test(static_cells_, index))
+        {
+            set(learned_cells_, index);
+            Point center = grid_.cell_center(index);
+            ESP_LOGI(TAG, "Masking cell at (%i, %i) mm with a stationary target", center.x, center.y);
+        }
+    }
+} // namespace esphome::ld2450
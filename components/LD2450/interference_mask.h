@@ -0,0 +1,165 @@
+#pragma once
+#include "esphome/core/automation.h"
+#include "esphome/core/hal.h"
+#include "grid.h"
+#include "zone.h"
+
+namespace esphome::ld2450
+{
+    /**
+     * @brief Exclusion mask for static sources of interference (fans, curtains, reflective surfaces).
+     * Configured regions are rasterized into a coarse bitmap during setup, such that masked targets are identified by a single lookup.
+     * Optionally, cells in which a target stays stationary for a long time are learned and added to the mask.
+     */
+    class InterferenceMask
+    {
+    public:
+        /**
+         * @brief Sets the covered area and the resolution of the mask.
+         * @param width width of the area along the x-axis in m, centered on the sensor
+         * @param depth depth of the area along the y-axis in m
+         * @param cell_size edge length of a cell in m
+         */
+        void set_dimensions(float width, float depth, float cell_size)
+        {
+            grid_.set_dimensions(width, depth, cell_size);
+        }
+
+        /**
+         * @brief Moves the corner of the covered area with the lowest coordinates.
+         * @param x_min lowest x coordinate in m
+         * @param y_min lowest y coordinate in m
+         */
+        void set_origin(float x_min, float y_min)
+        {
+            grid_.set_origin(x_min, y_min);
+        }
+
+        /**
+         * @brief Starts a new convex region, points are added with append_point().
+         */
+        void add_region()
+        {
+            regions_.emplace_back();
+        }
+
+        /**
+         * @brief Adds a point to the last region.
+         * @param x coordinate in m
+         * @param y coordinate in m
+         */
+        void append_point(float x, float y)
+        {
+            regions_.back().push_back(Point(int(x * 1000), int(y * 1000)));
+        }
+
+        /**
+         * @brief Enables learning of cells with long-lived stationary targets.
+         * @param stationary_time time in ms a target has to stay in the same cell without moving
+         */
+        void set_learning(uint32_t stationary_time)
+        {
+            learning_ = true;
+            stationary_time_ = stationary_time;
+        }
+
+        /**
+         * @brief Allocates and rasterizes the mask. Region definitions are released afterwards.
+         */
+        void setup();
+
+        /**
+         * Logs the mask configuration.
+         */
+        void dump_config();
+
+        /**
+         * @brief Checks whether a position is masked.
+         * @param x x coordinate in mm
+         * @param y y coordinate in mm
+         * @return true if the position is located in a masked cell
+         */
+        bool contains(int16_t x, int16_t y)
+        {
+            int32_t index = grid_.cell_index(x, y);
+            return index >= 0 && (test(static_cells_, index) || test(learned_cells_, index));
+        }
+
+        /**
+         * @brief Accounts a measurement for learning stationary targets.
+         * @param slot index of the target
+         * @param x x coordinate in mm
+         * @param y y coordinate in mm
+         * @param speed speed in mm/s
+         * @param resolution distance resolution, 0 if the target is absent
+         * @param timestamp time of the frame in ms
+         */
+        void observe(uint8_t slot, int16_t x, int16_t y, int16_t speed, int16_t resolution, uint32_t timestamp);
+
+        /**
+         * @brief Removes all learned cells from the mask.
+         */
+        void clear_learned()
+        {
+            std::fill(learned_cells_.begin(), learned_cells_.end(), 0);
+        }
+
+    protected:
+        /**
+         * @brief Checks a bit of a bitmap.
+         */
+        static bool test(const std::vector<uint32_t> &bitmap, int32_t index)
+        {
+            return bitmap[index >> 5] & (uint32_t(1) << (index & 31));
+        }
+
+        /**
+         * @brief Sets a bit of a bitmap.
+         */
+        static void set(std::vector<uint32_t> &bitmap, int32_t index)
+        {
+            bitmap[index >> 5] |= uint32_t(1) << (index & 31);
+        }
+
+        /// @brief Geometry of the mask
+        Grid grid_;
+
+        /// @brief Convex regions which are rasterized during setup
+        std::vector<std::vector<Point>> regions_{};
+
+        /// @brief Bitmap of cells masked by configured regions
+        std::vector<uint32_t> static_cells_{};
+
+        /// @brief Bitmap of learned cells
+        std::vector<uint32_t> learned_cells_{};
+
+        /// @brief Determines whether stationary targets are learned
+        bool learning_ = false;
+
+        /// @brief Time a target has to stay stationary before its cell is masked in ms
+        uint32_t stationary_time_ = 0;
+
+        /// @brief Cell in which each target is currently stationary, -1 if none
+        int32_t stationary_cell_[3] = {-1, -1, -1};
+
+        /// @brief Time since which each target is stationary
+        uint32_t stationary_since_[3] = {0, 0, 0};
+    };
+
+    template <typename... Ts>
+    class ClearLearnedMaskAction : public Action<Ts...>
+    {
+    public:
+        ClearLearnedMaskAction(InterferenceMask *parent)
+            : parent_(parent)
+        {
+        }
+
+        void play(const Ts &...x) override
+        {
+            this->parent_->clear_learned();
+        }
+
+        InterferenceMask *parent_;
+    };
+} // namespace esphome::ld2450
@@ -0,0 +1,54 @@
+#include "latency_monitor.h"
+
+namespace esphome::ld2450
+{
+    static const char *TAG = "LatencyMonitor";
+
+    static const char *const STAGE_NAMES[LATENCY_STAGE_COUNT] = {"queue", "processing", "publish", "end_to_end"};
+
+    void LatencyMonitor::dump_config()
+    {
+        ESP_LOGCONFIG(TAG, "Latency monitor:");
+#ifdef USE_SENSOR
+        LOG_SENSOR("  ", "QueueSensor", queue_sensor_);
+        LOG_SENSOR("  ", "ProcessingSensor", processing_sensor_);
+        LOG_SENSOR("  ", "PublishSensor", publish_sensor_);
+        LOG_SENSOR("  ", "EndToEndSensor", end_to_end_sensor_);
+#endif
+    }
+
+    void LatencyMonitor::publish_statistics()
+    {
+#ifdef USE_SENSOR
+        sensor::Sensor *sensors[LATENCY_STAGE_COUNT] = {queue_sensor_, processing_sensor_, publish_sensor_, end_to_end_sensor_};
+        for (uint8_t stage = 0; stage < LATENCY_STAGE_COUNT; stage++)
+        {
+            if (sensors[stage] != nullptr && histograms_[stage].get_window_count() > 0)
+                sensors[stage]->publish_state(histograms_[stage].window_percentile(LATENCY_PERCENTILE) / 1000.0f);
+        }
+#endif
+        for (LatencyHistogram &histogram : histograms_)
+            histogram.reset_window();
+    }
+
+    void LatencyMonitor::dump()
+    {
+        // One line per stage: count, max and the count of each bucket (upper bounds in µs)
+        char bounds[LATENCY_BUCKET_COUNT * 8 + 1];
+        size_t position = 0;
+        for (uint8_t bucket = 0; bucket < LATENCY_BUCKET_COUNT - 1; bucket++)
+            position += snprintf(bounds + position, sizeof(bounds) - position, " %u", unsigned(LATENCY_BUCKET_BOUNDS[bucket]));
+        snprintf(bounds + position, sizeof(bounds) - position, " inf");
+        ESP_LOGI(TAG, "LATENCY buckets (us):%s", bounds);
+
+        for (uint8_t stage = 0; stage < LATENCY_STAGE_COUNT; stage++)
+        {
+            const LatencyHistogram &histogram = histograms_[stage];
+            char counts[LATENCY_BUCKET_COUNT * 11 + 1];
+            position = 0;
+            for (uint8_t bucket = 0; bucket < LATENCY_BUCKET_COUNT; bucket++)
+                position += snprintf(counts + position, sizeof(counts) - position, " %u", unsigned(histogram.get_bucket(bucket)));
+            ESP_LOGI(TAG, "LATENCY %s count=%u max=%uus:%s", STAGE_NAMES[stage], unsigned(histogram.get_count()), unsigned(histogram.get_max()), counts);
+        }
+    }
+} // namespace esphome::ld2450
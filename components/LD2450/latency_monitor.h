@@ -0,0 +1,254 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include "esphome/core/automation.h"
+#include "esphome/core/component.h"
+#include "esphome/core/hal.h"
+#ifdef USE_SENSOR
+#include "esphome/components/sensor/sensor.h"
+#endif
+
+#define LATENCY_BUCKET_COUNT 13
+#define LATENCY_PERCENTILE 0.95f
+
+namespace esphome::ld2450
+{
+    /// @brief Upper bounds of the histogram buckets in µs, the last bucket collects all larger values
+    static const uint32_t LATENCY_BUCKET_BOUNDS[LATENCY_BUCKET_COUNT - 1] = {100, 200, 500, 1000, 2000, 5000, 10000, 20000, 50000, 100000, 200000, 500000};
+
+    /**
+     * @brief Processing stages of a data frame, for which latencies are measured.
+     */
+    enum LatencyStage : uint8_t
+    {
+        /// @brief Header detected until processing starts (decoding, queueing and loop scheduling)
+        LATENCY_QUEUE,
+        /// @brief Target, zone and line updates
+        LATENCY_PROCESSING,
+        /// @brief State commits including all publish_state() calls
+        LATENCY_PUBLISH,
+        /// @brief Header detected until all states are published
+        LATENCY_END_TO_END,
+        LATENCY_STAGE_COUNT,
+    };
+
+    /**
+     * @brief Latency histogram with fixed buckets. Counts are kept since the last reset and for the current publish window.
+     */
+    class LatencyHistogram
+    {
+    public:
+        /**
+         * @brief Accounts a single measurement.
+         * @param latency latency in µs
+         */
+        void add(uint32_t latency)
+        {
+            uint8_t bucket = 0;
+            while (bucket < LATENCY_BUCKET_COUNT - 1 && latency > LATENCY_BUCKET_BOUNDS[bucket])
+                bucket++;
+
+            counts_[bucket]++;
+            window_counts_[bucket]++;
+            count_++;
+            window_count_++;
+            max_ = std::max(max_, latency);
+            window_max_ = std::max(window_max_, latency);
+        }
+
+        /**
+         * @brief Estimates a percentile of the current window as the upper bound of the bucket which contains it.
+         * Values in the overflow bucket are reported by the largest measurement of the window.
+         * @param percentile percentile between 0 and 1
+         * @return latency in µs, 0 if the window is empty
+         */
+        uint32_t window_percentile(float percentile) const
+        {
+            if (window_count_ == 0)
+                return 0;
+
+            uint32_t rank = std::max<uint32_t>(1, ceilf(percentile * window_count_));
+            uint32_t accumulated = 0;
+            for (uint8_t bucket = 0; bucket < LATENCY_BUCKET_COUNT - 1; bucket++)
+            {
+                accumulated += window_counts_[bucket];
+                if (accumulated >= rank)
+                    return std::min(LATENCY_BUCKET_BOUNDS[bucket], window_max_);
+            }
+            return window_max_;
+        }
+
+        /**
+         * @brief Starts a new publish window.
+         */
+        void reset_window()
+        {
+            std::fill(window_counts_, window_counts_ + LATENCY_BUCKET_COUNT, 0);
+            window_count_ = 0;
+            window_max_ = 0;
+        }
+
+        /**
+         * @brief Clears all counts.
+         */
+        void reset()
+        {
+            std::fill(counts_, counts_ + LATENCY_BUCKET_COUNT, 0);
+            count_ = 0;
+            max_ = 0;
+            reset_window();
+        }
+
+        /**
+         * @brief Gets the number of measurements in the current window.
+         */
+        uint32_t get_window_count() const
+        {
+            return window_count_;
+        }
+
+        /**
+         * @brief Gets the number of measurements since the last reset.
+         */
+        uint32_t get_count() const
+        {
+            return count_;
+        }
+
+        /**
+         * @brief Gets the largest measurement since the last reset in µs.
+         */
+        uint32_t get_max() const
+        {
+            return max_;
+        }
+
+        /**
+         * @brief Gets the number of measurements of a bucket since the last reset.
+         * @param bucket bucket index
+         */
+        uint32_t get_bucket(uint8_t bucket) const
+        {
+            return bucket < LATENCY_BUCKET_COUNT ? counts_[bucket] : 0;
+        }
+
+    protected:
+        /// @brief Bucket counts since the last reset
+        uint32_t counts_[LATENCY_BUCKET_COUNT] = {0};
+
+        /// @brief Bucket counts of the current publish window
+        uint32_t window_counts_[LATENCY_BUCKET_COUNT] = {0};
+
+        /// @brief Number of measurements since the last reset
+        uint32_t count_ = 0;
+
+        /// @brief Number of measurements in the current publish window
+        uint32_t window_count_ = 0;
+
+        /// @brief Largest measurement since the last reset in µs
+        uint32_t max_ = 0;
+
+        /// @brief Largest measurement of the current publish window in µs
+        uint32_t window_max_ = 0;
+    };
+
+    /**
+     * @brief Measures the latency of data frames per processing stage and end to end, from the detection of the frame header
+     * until all states have been published. Percentiles are published periodically to diagnostic sensors.
+     */
+    class LatencyMonitor
+    {
+#ifdef USE_SENSOR
+        SUB_SENSOR(queue)
+        SUB_SENSOR(processing)
+        SUB_SENSOR(publish)
+        SUB_SENSOR(end_to_end)
+#endif
+    public:
+        /**
+         * Logs the latency monitor configuration.
+         */
+        void dump_config();
+
+        /**
+         * @brief Accounts the latencies of a processed frame.
+         * @param arrival time at which the frame header was detected in µs
+         * @param processing_start time at which processing of the frame started in µs
+         * @param processing_end time at which targets and zones were updated in µs
+         * @param published time at which all states were published in µs
+         */
+        void record(uint32_t arrival, uint32_t processing_start, uint32_t processing_end, uint32_t published)
+        {
+            histograms_[LATENCY_QUEUE].add(processing_start - arrival);
+            histograms_[LATENCY_PROCESSING].add(processing_end - processing_start);
+            histograms_[LATENCY_PUBLISH].add(published - processing_end);
+            histograms_[LATENCY_END_TO_END].add(published - arrival);
+        }
+
+        /**
+         * @brief Publishes the percentile of each stage within the current window and starts a new window.
+         */
+        void publish_statistics();
+
+        /**
+         * @brief Logs the histograms of all stages.
+         */
+        void dump();
+
+        /**
+         * @brief Clears the histograms of all stages.
+         */
+        void reset()
+        {
+            for (LatencyHistogram &histogram : histograms_)
+                histogram.reset();
+        }
+
+        /**
+         * @brief Gets the histogram of a stage.
+         * @param stage processing stage
+         */
+        const LatencyHistogram &get_histogram(LatencyStage stage) const
+        {
+            return histograms_[stage];
+        }
+
+    protected:
+        /// @brief Latency histograms per stage
+        LatencyHistogram histograms_[LATENCY_STAGE_COUNT];
+    };
+
+    template <typename... Ts>
+    class DumpLatencyAction : public Action<Ts...>
+    {
+    public:
+        DumpLatencyAction(LatencyMonitor *parent)
+            : parent_(parent)
+        {
+        }
+
+        void play(const Ts &...x) override
+        {
+            this->parent_->dump();
+        }
+
+        LatencyMonitor *parent_;
+    };
+
+    template <typename... Ts>
+    class ResetLatencyAction : public Action<Ts...>
+    {
+    public:
+        ResetLatencyAction(LatencyMonitor *parent)
+            : parent_(parent)
+        {
+        }
+
+        void play(const Ts &...x) override
+        {
+            this->parent_->reset();
+        }
+
+        LatencyMonitor *parent_;
+    };
+} // namespace esphome::ld2450
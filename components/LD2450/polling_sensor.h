@@ -6,13 +6,16 @@
 namespace esphome::ld2450
 {
     /**
-     * @brief Simple polling sensor which publishes it's values on a regular basis.
+     * @brief Simple polling sensor which publishes it's values on a regular basis. Publishing is scheduled by the LD2450 hub.
      * Additionally, this sensor converts the output according to the desired unit of measurement.
      */
-    class PollingSensor : public sensor::Sensor, public PollingComponent
+    class PollingSensor : public sensor::Sensor
     {
     public:
-        void setup() override
+        /**
+         * @brief Determines the unit conversion factor from the unit of measurement.
+         */
+        void setup_unit_conversion()
         {
             // Determine unit conversion
             if (unit_of_measurement_ != nullptr)
@@ -24,10 +27,46 @@ namespace esphome::ld2450
             }
         }
 
-        void update() override
+        /**
+         * @brief Sets the minimum time between two publishes.
+         * @param interval time in ms
+         */
+        void set_update_interval(uint32_t interval)
+        {
+            update_interval_ = interval;
+        }
+
+        /**
+         * @brief Sets the minimum change which is published. Smaller changes are suppressed.
+         * @param deadband minimum change in input units (i.e. mm for distances)
+         */
+        void set_deadband(float deadband)
+        {
+            deadband_ = deadband;
+        }
+
+        /**
+         * @brief Determines whether the value should be published.
+         * @param now current time in ms
+         * @return true if the update interval has passed and the value changed by at least the deadband
+         */
+        bool is_due(uint32_t now)
         {
-            if (raw_state != value_ && !(std::isnan(raw_state) && std::isnan(value_)))
-                publish_state(value_);
+            if (now - last_publish_ < update_interval_)
+                return false;
+            if (std::isnan(raw_state) || std::isnan(value_))
+                return std::isnan(raw_state) != std::isnan(value_);
+            return raw_state != value_ && std::abs(raw_state - value_) >= deadband_ * conversion_factor_;
+        }
+
+        /**
+         * @brief Publishes the current value.
+         * @param now current time in ms
+         */
+        void publish(uint32_t now)
+        {
+            last_publish_ = now;
+            publish_state(value_);
         }
 
         /**
@@ -45,5 +84,14 @@ namespace esphome::ld2450
 
         /// @brief Value of this sensor (un-published)
         float value_ = 0;
+
+        /// @brief Minimum change in input units which is published
+        float deadband_ = 0;
+
+        /// @brief Minimum time between two publishes in ms
+        uint32_t update_interval_ = 1000;
+
+        /// @brief timestamp of the last publish
+        uint32_t last_publish_ = 0;
     };
 } // namespace esphome::ld2450
\ No newline at end of file
@@ -0,0 +1,70 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace esphome::ld2450
+{
+    /**
+     * @brief Sequence lock which publishes a trivially copyable value from a single writer to any number of readers.
+     * Readers never block the writer and retry until they obtained a consistent copy.
+     * @tparam T trivially copyable value type
+     */
+    template <typename T>
+    class SeqLock
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "SeqLock values must be trivially copyable");
+
+        /// @brief Number of 32 bit words required for storing a value
+        static constexpr size_t WORDS = (sizeof(T) + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+
+    public:
+        /**
+         * @brief Publishes a new value (single writer only).
+         * @param value new value
+         */
+        void write(const T &value)
+        {
+            uint32_t words[WORDS] = {0};
+            memcpy(words, &value, sizeof(T));
+
+            // An odd sequence number marks an ongoing write
+            uint32_t sequence = sequence_.load(std::memory_order_relaxed);
+            sequence_.store(sequence + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            for (size_t i = 0; i < WORDS; i++)
+                data_[i].store(words[i], std::memory_order_relaxed);
+            sequence_.store(sequence + 2, std::memory_order_release);
+        }
+
+        /**
+         * @brief Reads a consistent copy of the latest value.
+         * @return copy of the latest value
+         */
+        T read() const
+        {
+            uint32_t words[WORDS];
+            uint32_t before, after;
+            do
+            {
+                before = sequence_.load(std::memory_order_acquire);
+                for (size_t i = 0; i < WORDS; i++)
+                    words[i] = data_[i].load(std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                after = sequence_.load(std::memory_order_relaxed);
+            } while ((before & 1) || before != after);
+
+            T value;
+            memcpy(&value, words, sizeof(T));
+            return value;
+        }
+
+    protected:
+        /// @brief Sequence number, odd while a write is in progress
+        std::atomic<uint32_t> sequence_{0};
+
+        /// @brief Value storage
+        std::atomic<uint32_t> data_[WORDS] = {};
+    };
+} // namespace esphome::ld2450
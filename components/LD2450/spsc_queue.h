@@ -0,0 +1,68 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+
+namespace esphome::ld2450
+{
+    /**
+     * @brief Lock-free single-producer/single-consumer ring buffer with a fixed capacity.
+     * Exactly one thread may call push() and exactly one (other) thread may call pop().
+     * @tparam T trivially copyable element type
+     * @tparam N number of slots, must be a power of two (capacity is N - 1)
+     */
+    template <typename T, size_t N>
+    class SpscQueue
+    {
+        static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscQueue size must be a power of two");
+
+    public:
+        /**
+         * @brief Appends an element to the queue (producer side).
+         * @param item element to copy into the queue
+         * @return false if the queue is full and the element was discarded
+         */
+        bool push(const T &item)
+        {
+            size_t head = head_.load(std::memory_order_relaxed);
+            size_t next = (head + 1) & (N - 1);
+            if (next == tail_.load(std::memory_order_acquire))
+                return false;
+            buffer_[head] = item;
+            head_.store(next, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Removes the oldest element from the queue (consumer side).
+         * @param item destination of the removed element
+         * @return false if the queue is empty
+         */
+        bool pop(T &item)
+        {
+            size_t tail = tail_.load(std::memory_order_relaxed);
+            if (tail == head_.load(std::memory_order_acquire))
+                return false;
+            item = buffer_[tail];
+            tail_.store((tail + 1) & (N - 1), std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Determines whether the queue is currently empty (consumer side).
+         */
+        bool empty() const
+        {
+            return tail_.load(std::memory_order_relaxed) == head_.load(std::memory_order_acquire);
+        }
+
+    protected:
+        /// @brief Index of the next slot written by the producer
+        std::atomic<size_t> head_{0};
+
+        /// @brief Index of the next slot read by the consumer
+        std::atomic<size_t> tail_{0};
+
+        /// @brief Element storage
+        T buffer_[N];
+    };
+} // namespace esphome::ld2450
@@ -5,67 +5,101 @@ namespace esphome::ld2450
 {
     static const char *TAG = "Target";
 
-    void Target::setup()
-    {
-    }
-
     void Target::dump_config()
     {
-        std::string name = name_ != nullptr ? name_ : "Unnamed Target";
-        ESP_LOGCONFIG(TAG, "Target: %s", name.c_str());
+        ESP_LOGCONFIG(TAG, "Target: %s", name_ != nullptr ? name_ : "Unnamed Target");
         ESP_LOGCONFIG(TAG, "  debug: %s", debug_ ? "True" : "False");
+        ESP_LOGCONFIG(TAG, "  prediction: %s", prediction_ ? "True" : "False");
         LOG_SENSOR("  ", "X Position", x_position_sensor_);
         LOG_SENSOR("  ", "Y Position", y_position_sensor_);
         LOG_SENSOR("  ", "Speed", speed_sensor_);
         LOG_SENSOR("  ", "Distance Resolution", distance_resolution_sensor_);
         LOG_SENSOR("  ", "Angle", angle_sensor_);
         LOG_SENSOR("  ", "Distance", distance_sensor_);
+        LOG_SENSOR("  ", "Heading", heading_sensor_);
+        LOG_SENSOR("  ", "Radial Velocity", radial_velocity_sensor_);
+#ifdef USE_BINARY_SENSOR
+        LOG_BINARY_SENSOR("  ", "Stationary", stationary_binary_sensor_);
+#endif
     }
 
-    void Target::loop()
+    void Target::update_values(int16_t x, int16_t y, int16_t speed, int16_t resolution, uint32_t timestamp)
     {
-        if (debug_)
+        bool was_located = has_position();
+        bool predicted = false;
+        if (prediction_)
         {
-            // Only show debug messages if updates are available
-            if (is_present() && millis() - last_debug_message_ > DEBUG_FREQUENCY)
+            if (resolution != 0)
+            {
+                tracker_.update(x, y, speed, timestamp);
+            }
+            else if (tracker_.is_initialized() && tracker_.get_missed_frames() < max_coast_frames_)
             {
-                last_debug_message_ = millis();
-                std::string name = name_ != nullptr ? name_ : "Unnamed Target";
-                ESP_LOGD(TAG, "Target %s: x:%i; y:%i; speed:%i; res:%i;", name.c_str(), x_, y_, speed_, resolution_);
+                // Bridge missing measurements using the predicted position, the target is marked as predicted instead of detected
+                tracker_.miss();
+                tracker_.predict(timestamp, x, y);
+                speed = speed_;
+                predicted = true;
+            }
+            else
+            {
+                tracker_.reset();
             }
         }
-    }
 
-    void Target::update_values(int16_t x, int16_t y, int16_t speed, int16_t resolution)
-    {
         if (fast_off_detection_ && resolution_ != 0 &&
             (x != x_ || y != y_ || speed != speed_ || resolution != resolution_))
-            last_change_ = millis();
+            last_change_ = timestamp;
+        previous_x_ = x_;
+        previous_y_ = y_;
+        previous_located_ = was_located;
         x_ = x;
         y_ = y;
         speed_ = speed;
         resolution_ = resolution;
+        predicted_ = predicted;
+
+        // Predicted positions are extrapolated from the trajectory and not added to it
+        if (resolution_ != 0)
+            trajectory_.add(x_, y_, timestamp);
+        else if (!predicted_)
+            trajectory_.clear();
 
         bool present = is_present();
+        // Positions are published for predicted targets as well, the distance resolution only for measurements
+        bool located = has_position();
+        // A complete window is required, such that a target which just appeared is not reported as stationary
+        stationary_ = present && trajectory_.is_full() && trajectory_.get_deviation() <= stationary_threshold_;
         // Update sub sensors
         if (x_position_sensor_ != nullptr)
-            x_position_sensor_->set_value(present ? x_ : NAN);
+            x_position_sensor_->set_value(located ? x_ : NAN);
         if (y_position_sensor_ != nullptr)
-            y_position_sensor_->set_value(present ? y_ : NAN);
+            y_position_sensor_->set_value(located ? y_ : NAN);
         if (speed_sensor_ != nullptr)
-            speed_sensor_->set_value(present ? speed_ : NAN);
+            speed_sensor_->set_value(located ? speed_ : NAN);
         if (distance_resolution_sensor_ != nullptr)
             distance_resolution_sensor_->set_value(present ? resolution_ : NAN);
+        // Angle and distance relate to the sensor, positions are in room coordinates if a mounting pose is applied
+        float sensor_x, sensor_y;
+        pose_.to_sensor(x_, y_, sensor_x, sensor_y);
         if (angle_sensor_ != nullptr)
         {
-            float angle = atan2(y, x) * (180 / M_PI) - 90;
-            angle_sensor_->set_value(present ? -angle : NAN);
+            float angle = atan2(sensor_y, sensor_x) * (180 / M_PI) - 90;
+            angle_sensor_->set_value(located ? -angle : NAN);
         }
         if (distance_sensor_ != nullptr)
         {
-            float distance = sqrt(x_ * x_ + y_ * y_);
-            distance_sensor_->set_value(present ? distance : NAN);
+            float distance = sqrt(sensor_x * sensor_x + sensor_y * sensor_y);
+            distance_sensor_->set_value(located ? distance : NAN);
         }
+        if (heading_sensor_ != nullptr)
+            heading_sensor_->set_value(located ? trajectory_.get_heading(stationary_threshold_) : NAN);
+        if (radial_velocity_sensor_ != nullptr)
+            radial_velocity_sensor_->set_value(located ? trajectory_.get_radial_velocity() / 1000 : NAN);
+#ifdef USE_BINARY_SENSOR
+        if (stationary_binary_sensor_ != nullptr && (!stationary_binary_sensor_->has_state() || stationary_binary_sensor_->state != stationary_))
+            stationary_binary_sensor_->publish_state(stationary_);
+#endif
     }
 
     bool Target::is_present()
@@ -1,23 +1,30 @@
 #pragma once
 
-#include "esphome/core/component.h"
 #include "esphome/core/hal.h"
 #include "polling_sensor.h"
+#include "tracker.h"
+#include "trajectory.h"
+#ifdef USE_BINARY_SENSOR
+#include "esphome/components/binary_sensor/binary_sensor.h"
+#endif
 
-#define DEBUG_FREQUENCY 1000
 #define FAST_OFF_THRESHOLD 100
 
 namespace esphome::ld2450
 {
     /**
-     * @brief Target component which provides information about a single target and updates derived sensor components.
+     * @brief Target which provides information about a single target and updates derived sensor components. Targets are updated by the LD2450 hub.
      */
-    class Target : public Component
+    class Target
     {
+#ifdef USE_BINARY_SENSOR
+        SUB_BINARY_SENSOR(stationary)
+#endif
     public:
-        void setup() override;
-        void loop() override;
-        void dump_config() override;
+        /**
+         * Logs the target configuration.
+         */
+        void dump_config();
 
         /**
          * @brief Sets the name of this component
@@ -28,13 +35,21 @@ namespace esphome::ld2450
         }
 
         /**
-         * @brief Sets the debugging flag, which enables/disables raw value debug output.
+         * @brief Sets the debugging flag, which enables/disables recording of raw values in the trace of the hub.
          */
         void set_debugging(bool flag)
         {
             debug_ = flag;
         }
 
+        /**
+         * @brief Determines whether raw values of this target are traced.
+         */
+        bool is_debugging()
+        {
+            return debug_;
+        }
+
         /**
          * @brief Sets the fast of detection flag, which determines how the unoccupied state is determined.
          */
@@ -43,6 +58,74 @@ namespace esphome::ld2450
             fast_off_detection_ = flag;
         }
 
+        /**
+         * @brief Enables constant-velocity prediction for this target.
+         * @param alpha position correction gain of the tracker
+         * @param beta velocity correction gain of the tracker
+         * @param max_coast_frames number of frames without measurement, which are bridged using the predicted position
+         * @param lookahead time in ms used for predicting zone entries
+         */
+        void set_prediction(float alpha, float beta, uint8_t max_coast_frames, uint32_t lookahead)
+        {
+            prediction_ = true;
+            tracker_.set_gains(alpha, beta);
+            max_coast_frames_ = max_coast_frames;
+            lookahead_ = lookahead;
+        }
+
+        /**
+         * @brief Sets the pose of the sensor in room coordinates if a mounting pose is applied. Angle, distance, heading,
+         * radial velocity and the tracker relate room coordinates back to the sensor using this pose.
+         * @param x x coordinate in mm
+         * @param y y coordinate in mm
+         * @param cos_rotation cosine of the counter-clockwise rotation of the sensor
+         * @param sin_rotation sine of the counter-clockwise rotation of the sensor
+         */
+        void set_sensor_pose(int16_t x, int16_t y, float cos_rotation, float sin_rotation)
+        {
+            pose_ = {float(x), float(y), cos_rotation, sin_rotation};
+            tracker_.set_origin(x, y);
+            trajectory_.set_sensor_pose(pose_);
+        }
+
+        /**
+         * @brief Sets the maximum deviation of the positions within the trajectory window for which the target is considered stationary.
+         * Movements below this threshold do not determine a heading.
+         * @param threshold deviation in mm
+         */
+        void set_stationary_threshold(float threshold)
+        {
+            stationary_threshold_ = threshold;
+        }
+
+        /**
+         * @brief Predicts the position of this target after the configured lookahead time.
+         * @param timestamp time of the current frame in ms
+         * @param x predicted x coordinate
+         * @param y predicted y coordinate
+         * @return false if no prediction is available
+         */
+        bool get_predicted_position(uint32_t timestamp, int16_t &x, int16_t &y)
+        {
+            if (!prediction_ || lookahead_ == 0 || !tracker_.is_initialized())
+                return false;
+            tracker_.predict(timestamp + lookahead_, x, y);
+            return true;
+        }
+
+        /**
+         * @brief Gets the position of this target before the last update.
+         * @param x previous x coordinate
+         * @param y previous y coordinate
+         * @return false if the target was neither detected nor predicted during the previous or the last update
+         */
+        bool get_previous_position(int16_t &x, int16_t &y)
+        {
+            x = previous_x_;
+            y = previous_y_;
+            return previous_located_ && has_position();
+        }
+
         /**
          * @brief Sets the x position sensor reference
          * @param reference polling sensor reference
@@ -97,21 +180,69 @@ namespace esphome::ld2450
             distance_sensor_ = distance_sensor;
         }
 
+        /**
+         * @brief Sets the heading sensor reference
+         * @param reference polling sensor reference
+         */
+        void set_heading_sensor(PollingSensor *heading_sensor)
+        {
+            heading_sensor_ = heading_sensor;
+        }
+
+        /**
+         * @brief Sets the radial velocity sensor reference
+         * @param reference polling sensor reference
+         */
+        void set_radial_velocity_sensor(PollingSensor *radial_velocity_sensor)
+        {
+            radial_velocity_sensor_ = radial_velocity_sensor;
+        }
+
+        /**
+         * @brief Adds all derived sensors of this target to the given list.
+         * @param sensors list of sensors
+         */
+        void get_sensors(std::vector<PollingSensor *> &sensors)
+        {
+            for (PollingSensor *sensor : {x_position_sensor_, y_position_sensor_, speed_sensor_, distance_resolution_sensor_, angle_sensor_, distance_sensor_, heading_sensor_, radial_velocity_sensor_})
+            {
+                if (sensor != nullptr)
+                    sensors.push_back(sensor);
+            }
+        }
+
         /**
          * @brief Updates the value in this target object
          * @param x The x coordinate of the target
          * @param y The y coordinate of the target
          * @param speed The speed of the target
          * @param resolution The distance resolution of the measurement
+         * @param timestamp The time at which the frame of the measurement was received in ms
          */
-        void update_values(int16_t x, int16_t y, int16_t speed, int16_t resolution);
+        void update_values(int16_t x, int16_t y, int16_t speed, int16_t resolution, uint32_t timestamp);
 
         /**
-         * @brief Determines whether this target is currently detected.
+         * @brief Determines whether this target is currently detected. Targets bridged by prediction are not detected.
          * @return true if the target is detected, false otherwise
          */
         bool is_present();
 
+        /**
+         * @brief Determines whether the position of this target is predicted, as the sensor did not report the target for up to max_coast_frames messages.
+         */
+        bool is_predicted()
+        {
+            return predicted_;
+        }
+
+        /**
+         * @brief Determines whether this target has a position, either detected or predicted.
+         */
+        bool has_position()
+        {
+            return predicted_ || is_present();
+        }
+
         /**
          * @brief Determines if this target is currently moving
          * @return true if the target is moving, false if it is stationary.
@@ -135,7 +266,9 @@ namespace esphome::ld2450
          */
         void clear()
         {
-            update_values(0, 0, 0, 0);
+            tracker_.reset();
+            trajectory_.clear();
+            update_values(0, 0, 0, 0, millis());
         }
 
         /**
@@ -174,6 +307,24 @@ namespace esphome::ld2450
             return speed_;
         }
 
+        /**
+         * Gets the recent positions of this target
+         * @return trajectory window
+         */
+        Trajectory &get_trajectory()
+        {
+            return trajectory_;
+        }
+
+        /**
+         * Determines whether the positions within the trajectory window deviate less than the stationary threshold
+         * @return true if the target is present and stationary
+         */
+        bool is_stationary()
+        {
+            return stationary_;
+        }
+
         /**
          * Gets the distance resolution of this target
          * @return distance error
@@ -196,17 +347,50 @@ namespace esphome::ld2450
         /// @brief distance resolution of the target
         int16_t resolution_ = 0;
 
+        /// @brief X coordinate before the last update
+        int16_t previous_x_ = 0;
+
+        /// @brief Y coordinate before the last update
+        int16_t previous_y_ = 0;
+
+        /// @brief Determines whether the target was detected or predicted before the last update
+        bool previous_located_ = false;
+
+        /// @brief Determines whether the current position is predicted instead of measured, the resolution is 0 in this case
+        bool predicted_ = false;
+
         /// @brief  Name of this target
         const char *name_ = nullptr;
 
-        /// @brief Debugging flag, enables logs for value changes
+        /// @brief Debugging flag, enables tracing of raw values
         bool debug_ = false;
 
         /// @brief Determines whether the fast unoccupied detection method is applied
         bool fast_off_detection_ = false;
 
-        /// @brief time stamp of the last debug message which was sent.
-        uint32_t last_debug_message_ = 0;
+        /// @brief Determines whether target positions are predicted
+        bool prediction_ = false;
+
+        /// @brief Constant velocity tracker used for prediction
+        AlphaBetaTracker tracker_;
+
+        /// @brief Maximum number of consecutive frames without measurement, which are bridged by prediction
+        uint8_t max_coast_frames_ = 0;
+
+        /// @brief Prediction time in ms used for zone entries
+        uint32_t lookahead_ = 0;
+
+        /// @brief Recent positions of the target, used for heading, radial velocity and the stationary state
+        Trajectory trajectory_;
+
+        /// @brief Pose of the sensor in room coordinates, identity unless a mounting pose is applied
+        SensorPose pose_{};
+
+        /// @brief Maximum deviation in mm of the positions within the trajectory window for stationary targets
+        float stationary_threshold_ = 100;
+
+        /// @brief Current stationary state
+        bool stationary_ = false;
 
         /// @brief time of the last value change
         uint32_t last_change_ = 0;
@@ -228,5 +412,11 @@ namespace esphome::ld2450
 
         /// @brief sensor reference of the distance sensor
         PollingSensor *distance_sensor_ = nullptr;
+
+        /// @brief sensor reference of the heading sensor
+        PollingSensor *heading_sensor_ = nullptr;
+
+        /// @brief sensor reference of the radial velocity sensor
+        PollingSensor *radial_velocity_sensor_ = nullptr;
     };
 } // namespace esphome::ld2450
\ No newline at end of file
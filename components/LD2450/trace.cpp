@@ -0,0 +1,27 @@
+#include "esphome/core/log.h"
+#include "base64_dump.h"
+#include "trace.h"
+
+namespace esphome::ld2450
+{
+    static const char *TAG = "Trace";
+
+    void TraceBuffer::dump_config()
+    {
+        ESP_LOGCONFIG(TAG, "Trace:");
+        ESP_LOGCONFIG(TAG, "  size: %u records", unsigned(size_));
+    }
+
+    void TraceBuffer::dump()
+    {
+        // Header: number of records and record size, followed by numbered chunks of base64 encoded records (oldest first)
+        ESP_LOGI(TAG, "TRACE %u %u", unsigned(count_), unsigned(sizeof(TraceRecord)));
+
+        // Bytes of the records in ring order, the record layout is little endian on all supported platforms
+        size_t oldest = count_ > 0 ? (head_ + records_.size() - count_) % records_.size() : 0;
+        chunked_base64_dump(TAG, "TRACE", count_ * sizeof(TraceRecord), [this, oldest](size_t index) -> uint8_t
+                            {
+            const TraceRecord &record = records_[(oldest + index / sizeof(TraceRecord)) % records_.size()];
+            return reinterpret_cast<const uint8_t *>(&record)[index % sizeof(TraceRecord)]; });
+    }
+} // namespace esphome::ld2450
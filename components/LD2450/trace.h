@@ -0,0 +1,139 @@
+#pragma once
+#include <vector>
+#include "esphome/core/automation.h"
+#include "esphome/core/hal.h"
+
+namespace esphome::ld2450
+{
+    /**
+     * @brief Single traced measurement of a target. Stored and dumped in binary form (12 bytes, little endian).
+     */
+    struct TraceRecord
+    {
+        /// @brief Sequence number of the sensor message (lower 16 bits)
+        uint16_t sequence;
+
+        /// @brief Slot of the measurement within the sensor message
+        uint8_t slot;
+
+        /// @brief Index of the target which was updated by the measurement
+        uint8_t target;
+
+        /// @brief X coordinate in mm
+        int16_t x;
+
+        /// @brief Y coordinate in mm
+        int16_t y;
+
+        /// @brief Speed in cm/s
+        int16_t speed;
+
+        /// @brief Distance resolution in mm, 0 if the slot was empty
+        uint16_t resolution;
+    };
+
+    static_assert(sizeof(TraceRecord) == 12, "TraceRecord must not contain padding");
+
+    /**
+     * @brief Ring of recent target measurements for debugging. Recording only copies the measurement, formatting is deferred until the trace is dumped.
+     */
+    class TraceBuffer
+    {
+    public:
+        /**
+         * @brief Sets the number of records, which are allocated once during setup.
+         * @param size number of records
+         */
+        void set_size(uint16_t size)
+        {
+            size_ = size;
+        }
+
+        /**
+         * @brief Allocates the record storage. The storage is never resized afterwards.
+         */
+        void setup()
+        {
+            records_.resize(size_);
+        }
+
+        /**
+         * Logs the trace configuration.
+         */
+        void dump_config();
+
+        /**
+         * @brief Stores a measurement, replacing the oldest record once the ring is full.
+         */
+        void record(uint16_t sequence, uint8_t slot, uint8_t target, int16_t x, int16_t y, int16_t speed, uint16_t resolution)
+        {
+            if (records_.empty())
+                return;
+            records_[head_] = {sequence, slot, target, x, y, speed, resolution};
+            head_ = (head_ + 1) % records_.size();
+            if (count_ < records_.size())
+                count_++;
+        }
+
+        /**
+         * @brief Writes all records (oldest first) to the log as base64 encoded chunks, which are decoded by tools/decode_trace.py.
+         */
+        void dump();
+
+        /**
+         * @brief Removes all records.
+         */
+        void clear()
+        {
+            head_ = 0;
+            count_ = 0;
+        }
+
+    protected:
+        /// @brief Record storage, allocated once during setup
+        std::vector<TraceRecord> records_{};
+
+        /// @brief Configured number of records
+        uint16_t size_ = 128;
+
+        /// @brief Index at which the next record is stored
+        uint16_t head_ = 0;
+
+        /// @brief Number of stored records
+        uint16_t count_ = 0;
+    };
+
+    template <typename... Ts>
+    class DumpTraceAction : public Action<Ts...>
+    {
+    public:
+        DumpTraceAction(TraceBuffer *parent)
+            : parent_(parent)
+        {
+        }
+
+        void play(const Ts &...x) override
+        {
+            this->parent_->dump();
+        }
+
+        TraceBuffer *parent_;
+    };
+
+    template <typename... Ts>
+    class ClearTraceAction : public Action<Ts...>
+    {
+    public:
+        ClearTraceAction(TraceBuffer *parent)
+            : parent_(parent)
+        {
+        }
+
+        void play(const Ts &...x) override
+        {
+            this->parent_->clear();
+        }
+
+        TraceBuffer *parent_;
+    };
+} // namespace esphome::ld2450
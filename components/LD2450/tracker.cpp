@@ -0,0 +1,62 @@
+#include <algorithm>
+#include <cmath>
+#include "tracker.h"
+
+namespace esphome::ld2450
+{
+    void AlphaBetaTracker::seed(int16_t x, int16_t y, int16_t speed, uint32_t time)
+    {
+        x_ = x;
+        y_ = y;
+        vx_ = 0;
+        vy_ = 0;
+
+        // The sensor only reports the radial component of the velocity (cm/s = 0.01 mm/ms), directed away from the sensor position
+        float dx = float(x) - origin_x_;
+        float dy = float(y) - origin_y_;
+        float distance = sqrtf(dx * dx + dy * dy);
+        if (distance > 0)
+        {
+            vx_ = speed * 0.01f * dx / distance;
+            vy_ = speed * 0.01f * dy / distance;
+        }
+
+        last_update_ = time;
+        missed_frames_ = 0;
+        initialized_ = true;
+    }
+
+    void AlphaBetaTracker::update(int16_t x, int16_t y, int16_t speed, uint32_t time)
+    {
+        if (!initialized_)
+        {
+            seed(x, y, speed, time);
+            return;
+        }
+
+        float dt = time - last_update_;
+        if (dt <= 0)
+            return;
+
+        // Predict and correct with the residual
+        float predicted_x = x_ + vx_ * dt;
+        float predicted_y = y_ + vy_ * dt;
+        float residual_x = x - predicted_x;
+        float residual_y = y - predicted_y;
+        x_ = predicted_x + alpha_ * residual_x;
+        y_ = predicted_y + alpha_ * residual_y;
+        vx_ += beta_ * residual_x / dt;
+        vy_ += beta_ * residual_y / dt;
+
+        last_update_ = time;
+        missed_frames_ = 0;
+    }
+
+    void AlphaBetaTracker::predict(uint32_t time, int16_t &x, int16_t &y)
+    {
+        // Fast targets which coast for long extrapolate beyond the coordinate range, converting such values to int16_t is undefined
+        float dt = int32_t(time - last_update_);
+        x = int16_t(std::clamp(x_ + vx_ * dt, float(INT16_MIN), float(INT16_MAX)));
+        y = int16_t(std::clamp(y_ + vy_ * dt, float(INT16_MIN), float(INT16_MAX)));
+    }
+} // namespace esphome::ld2450
@@ -0,0 +1,118 @@
+#pragma once
+#include <cstdint>
+
+namespace esphome::ld2450
+{
+    /**
+     * @brief Constant-velocity alpha-beta filter with fixed-size state, used to predict target positions.
+     */
+    class AlphaBetaTracker
+    {
+    public:
+        /**
+         * @brief Sets the filter gains.
+         * @param alpha position correction gain (0-1)
+         * @param beta velocity correction gain (0-1)
+         */
+        void set_gains(float alpha, float beta)
+        {
+            alpha_ = alpha;
+            beta_ = beta;
+        }
+
+        /**
+         * @brief Sets the position of the sensor in the coordinate system of the measurements, which is required to seed the velocity from the radial speed.
+         * @param x x coordinate in mm
+         * @param y y coordinate in mm
+         */
+        void set_origin(int16_t x, int16_t y)
+        {
+            origin_x_ = x;
+            origin_y_ = y;
+        }
+
+        /**
+         * @brief Determines whether the tracker holds a valid state.
+         */
+        bool is_initialized()
+        {
+            return initialized_;
+        }
+
+        /**
+         * @brief Number of consecutive updates without a measurement.
+         */
+        uint8_t get_missed_frames()
+        {
+            return missed_frames_;
+        }
+
+        /**
+         * @brief Initializes the state from a single measurement. The velocity is seeded from the radial speed reported by the sensor.
+         * @param x x coordinate in mm
+         * @param y y coordinate in mm
+         * @param speed radial speed in cm/s (positive values move away from the sensor)
+         * @param time timestamp of the measurement in ms
+         */
+        void seed(int16_t x, int16_t y, int16_t speed, uint32_t time);
+
+        /**
+         * @brief Corrects the state with a new measurement.
+         * @param x x coordinate in mm
+         * @param y y coordinate in mm
+         * @param speed radial speed in cm/s, used if the tracker is not initialized yet
+         * @param time timestamp of the measurement in ms
+         */
+        void update(int16_t x, int16_t y, int16_t speed, uint32_t time);
+
+        /**
+         * @brief Registers a frame without measurement.
+         */
+        void miss()
+        {
+            missed_frames_++;
+        }
+
+        /**
+         * @brief Predicts the position at the given time, limited to the range of the coordinates.
+         * @param time time in ms
+         * @param x predicted x coordinate in mm
+         * @param y predicted y coordinate in mm
+         */
+        void predict(uint32_t time, int16_t &x, int16_t &y);
+
+        /**
+         * @brief Invalidates the current state.
+         */
+        void reset()
+        {
+            initialized_ = false;
+            missed_frames_ = 0;
+        }
+
+    protected:
+        /// @brief filtered position in mm
+        float x_ = 0, y_ = 0;
+
+        /// @brief filtered velocity in mm/ms
+        float vx_ = 0, vy_ = 0;
+
+        /// @brief timestamp of the last measurement
+        uint32_t last_update_ = 0;
+
+        /// @brief position correction gain
+        float alpha_ = 0.5f;
+
+        /// @brief velocity correction gain
+        float beta_ = 0.1f;
+
+        /// @brief position of the sensor in mm, (0, 0) unless a mounting pose is applied
+        int16_t origin_x_ = 0, origin_y_ = 0;
+
+        /// @brief number of consecutive frames without measurement
+        uint8_t missed_frames_ = 0;
+
+        /// @brief true if the state is valid
+        bool initialized_ = false;
+    };
+} // namespace esphome::ld2450
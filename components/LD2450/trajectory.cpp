@@ -0,0 +1,84 @@
+#include <cmath>
+#include "trajectory.h"
+
+namespace esphome::ld2450
+{
+    void Trajectory::add(int16_t x, int16_t y, uint32_t time)
+    {
+        if (count_ == TRAJECTORY_LENGTH)
+        {
+            // Drop the oldest position from the window, it is overwritten below
+            sum_x_ -= x_[head_];
+            sum_y_ -= y_[head_];
+            sum_xx_ -= int32_t(x_[head_]) * x_[head_];
+            sum_yy_ -= int32_t(y_[head_]) * y_[head_];
+        }
+        else
+        {
+            count_++;
+        }
+
+        x_[head_] = x;
+        y_[head_] = y;
+        time_[head_] = time;
+        sum_x_ += x;
+        sum_y_ += y;
+        sum_xx_ += int32_t(x) * x;
+        sum_yy_ += int32_t(y) * y;
+        head_ = (head_ + 1) % TRAJECTORY_LENGTH;
+    }
+
+    void Trajectory::clear()
+    {
+        head_ = 0;
+        count_ = 0;
+        sum_x_ = 0;
+        sum_y_ = 0;
+        sum_xx_ = 0;
+        sum_yy_ = 0;
+    }
+
+    float Trajectory::get_heading(float min_displacement)
+    {
+        if (count_ < 2)
+            return NAN;
+
+        uint8_t newest = index(0);
+        uint8_t oldest = index(count_ - 1);
+        float dx = x_[newest] - x_[oldest];
+        float dy = y_[newest] - y_[oldest];
+        if (dx * dx + dy * dy < min_displacement * min_displacement)
+            return NAN;
+        // The heading is relative to the facing direction of the sensor
+        float sensor_dx, sensor_dy;
+        pose_.rotate_to_sensor(dx, dy, sensor_dx, sensor_dy);
+        return atan2f(sensor_dx, sensor_dy) * (180 / M_PI);
+    }
+
+    float Trajectory::get_radial_velocity()
+    {
+        if (count_ < 2)
+            return NAN;
+
+        uint8_t newest = index(0);
+        uint8_t oldest = index(count_ - 1);
+        uint32_t duration = time_[newest] - time_[oldest];
+        if (duration == 0)
+            return NAN;
+        float distance_newest = hypotf(x_[newest] - pose_.x, y_[newest] - pose_.y);
+        float distance_oldest = hypotf(x_[oldest] - pose_.x, y_[oldest] - pose_.y);
+        return (distance_newest - distance_oldest) * 1000 / duration;
+    }
+
+    float Trajectory::get_deviation()
+    {
+        if (count_ == 0)
+            return 0;
+
+        // Var = E[X²] - E[X]², combined for both axes
+        float mean_x = float(sum_x_) / count_;
+        float mean_y = float(sum_y_) / count_;
+        float variance = float(sum_xx_) / count_ - mean_x * mean_x + float(sum_yy_) / count_ - mean_y * mean_y;
+        return variance > 0 ? sqrtf(variance) : 0;
+    }
+} // namespace esphome::ld2450
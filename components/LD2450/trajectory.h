@@ -0,0 +1,139 @@
+#pragma once
+#include <cstdint>
+
+#define TRAJECTORY_LENGTH 10
+
+namespace esphome::ld2450
+{
+    /**
+     * @brief Position and rotation of the sensor in room coordinates, used to relate room coordinates back to the sensor.
+     */
+    struct SensorPose
+    {
+        /// @brief Position of the sensor in mm
+        float x = 0, y = 0;
+
+        /// @brief Cosine and sine of the counter-clockwise rotation of the sensor
+        float cos_rotation = 1, sin_rotation = 0;
+
+        /**
+         * @brief Transforms an offset in room coordinates into the sensor frame by reverting the rotation.
+         * @param dx offset along the x-axis of the room
+         * @param dy offset along the y-axis of the room
+         * @param sensor_dx offset along the x-axis of the sensor
+         * @param sensor_dy offset along the y-axis of the sensor (facing direction)
+         */
+        void rotate_to_sensor(float dx, float dy, float &sensor_dx, float &sensor_dy) const
+        {
+            sensor_dx = cos_rotation * dx + sin_rotation * dy;
+            sensor_dy = cos_rotation * dy - sin_rotation * dx;
+        }
+
+        /**
+         * @brief Transforms a point in room coordinates into sensor coordinates.
+         */
+        void to_sensor(float x, float y, float &sensor_x, float &sensor_y) const
+        {
+            rotate_to_sensor(x - this->x, y - this->y, sensor_x, sensor_y);
+        }
+    };
+
+    /**
+     * @brief Fixed-size ring of recent target positions. Statistics over the window are maintained incrementally,
+     * such that each update and query is O(1) without allocations.
+     */
+    class Trajectory
+    {
+    public:
+        /**
+         * @brief Sets the pose of the sensor, such that heading and radial velocity are determined relative to the sensor if positions are in room coordinates.
+         */
+        void set_sensor_pose(const SensorPose &pose)
+        {
+            pose_ = pose;
+        }
+
+        /**
+         * @brief Adds a position to the ring, replacing the oldest position once the ring is full.
+         * @param x x coordinate in mm
+         * @param y y coordinate in mm
+         * @param time timestamp of the measurement in ms
+         */
+        void add(int16_t x, int16_t y, uint32_t time);
+
+        /**
+         * @brief Removes all positions.
+         */
+        void clear();
+
+        /**
+         * @brief Number of positions within the ring.
+         */
+        uint8_t size()
+        {
+            return count_;
+        }
+
+        /**
+         * @brief Determines whether the ring contains a complete window.
+         */
+        bool is_full()
+        {
+            return count_ == TRAJECTORY_LENGTH;
+        }
+
+        /**
+         * @brief Direction of travel between the oldest and the newest position of the window.
+         * Uses the convention of the angle sensor: 0° moves straight away from the sensor, positive values move towards positive x.
+         * @param min_displacement minimum displacement in mm, below which no heading is determined
+         * @return heading in degrees (-180 to 180), NAN if the target did not move far enough
+         */
+        float get_heading(float min_displacement);
+
+        /**
+         * @brief Radial velocity averaged over the window, i.e. the change in distance to the sensor between the oldest and the newest position.
+         * @return velocity in mm/s (positive values move away from the sensor), NAN if the window spans no time
+         */
+        float get_radial_velocity();
+
+        /**
+         * @brief Standard deviation of the positions within the window, combined over both axes.
+         * @return deviation in mm
+         */
+        float get_deviation();
+
+    protected:
+        /**
+         * @brief Gets the ring index of a position.
+         * @param age 0 for the newest position, size() - 1 for the oldest
+         */
+        uint8_t index(uint8_t age)
+        {
+            return (head_ + TRAJECTORY_LENGTH - 1 - age) % TRAJECTORY_LENGTH;
+        }
+
+        /// @brief x coordinates in mm
+        int16_t x_[TRAJECTORY_LENGTH] = {0};
+
+        /// @brief y coordinates in mm
+        int16_t y_[TRAJECTORY_LENGTH] = {0};
+
+        /// @brief timestamps in ms
+        uint32_t time_[TRAJECTORY_LENGTH] = {0};
+
+        /// @brief index at which the next position is stored
+        uint8_t head_ = 0;
+
+        /// @brief number of stored positions
+        uint8_t count_ = 0;
+
+        /// @brief running sums of the coordinates within the window
+        int32_t sum_x_ = 0, sum_y_ = 0;
+
+        /// @brief running sums of the squared coordinates within the window, integers avoid drift of incremental updates
+        int64_t sum_xx_ = 0, sum_yy_ = 0;
+
+        /// @brief pose of the sensor, identity unless a mounting pose is applied
+        SensorPose pose_{};
+    };
+} // namespace esphome::ld2450
@@ -4,7 +4,7 @@ namespace esphome::ld2450
 {
     const char *TAG = "Zone";
 
-    bool is_convex(std::vector<Point> polygon)
+    bool is_convex(const std::vector<Point> &polygon)
     {
         if (polygon.size() < 3)
             return false;
@@ -30,26 +30,138 @@ namespace esphome::ld2450
         return true;
     }
 
+    void Zone::setup()
+    {
+        // The preference key is derived once, persisting a polygon later on does not build strings. Zones of several sensors
+        // may share their name, hence the key is derived from the id of the zone.
+        pref_key_ = fnv1_hash(std::string("LD2450 zone ") + (component_id_ != nullptr ? component_id_ : name_));
+        // Circles, rings and sectors are not replaced by a persisted polygon, as the blob does not describe their shape
+        if (restore_polygon_ && shape_ != SHAPE_POLYGON)
+        {
+            ESP_LOGW(TAG, "Zone %s: persisted polygons can only be restored into polygon zones", name_);
+        }
+        else if (restore_polygon_)
+        {
+            make_preference();
+            ZonePolygonBlob blob;
+            if (pref_.load(&blob) && blob.version == ZONE_POLYGON_BLOB_VERSION && blob.size <= ZONE_POLYGON_MAX_PERSISTED_POINTS)
+            {
+                std::vector<Point> polygon;
+                for (int i = 0; i < blob.size; i++)
+                    polygon.push_back(Point(blob.points[i][0], blob.points[i][1]));
+                if (update_polygon(polygon))
+                    ESP_LOGD(TAG, "Zone %s: restored polygon with %i points", name_, int(blob.size));
+                else
+                    ESP_LOGW(TAG, "Zone %s: persisted polygon is invalid, using the configured area", name_);
+            }
+        }
+
+        if (shape_ == SHAPE_POLYGON)
+            build_geometry();
+    }
+
+    void Zone::make_preference()
+    {
+        if (has_pref_)
+            return;
+        pref_ = global_preferences->make_preference<ZonePolygonBlob>(pref_key_);
+        has_pref_ = true;
+    }
+
+    bool Zone::store_polygon(const std::vector<Point> &polygon)
+    {
+        if (polygon.size() > ZONE_POLYGON_MAX_PERSISTED_POINTS)
+        {
+            ESP_LOGW(TAG, "Zone %s: polygons with more than %i points cannot be persisted", name_, ZONE_POLYGON_MAX_PERSISTED_POINTS);
+            return false;
+        }
+        // Points are stored as int16_t, points beyond the range would be silently moved
+        for (const Point &point : polygon)
+        {
+            if (point.x < INT16_MIN || point.x > INT16_MAX || point.y < INT16_MIN || point.y > INT16_MAX)
+            {
+                ESP_LOGW(TAG, "Zone %s: polygon point (%i, %i) is out of range and cannot be persisted", name_, point.x, point.y);
+                return false;
+            }
+        }
+        if (!update_polygon(polygon))
+            return false;
+
+        ZonePolygonBlob blob{};
+        blob.version = ZONE_POLYGON_BLOB_VERSION;
+        blob.size = polygon.size();
+        for (size_t i = 0; i < polygon.size(); i++)
+        {
+            blob.points[i][0] = polygon[i].x;
+            blob.points[i][1] = polygon[i].y;
+        }
+        make_preference();
+        pref_.save(&blob);
+        return true;
+    }
+
+    void Zone::build_geometry()
+    {
+        edges_.clear();
+        size_t size = polygon_.size();
+        if (size < 3)
+            return;
+
+        min_corner_ = max_corner_ = polygon_[0];
+        for (size_t i = 0; i < size; i++)
+        {
+            const Point &start = polygon_[i];
+            const Point &end = polygon_[(i + 1) % size];
+            int32_t dx = end.x - start.x;
+            int32_t dy = end.y - start.y;
+            edges_.push_back({start, dx, dy, float(dx) * dx + float(dy) * dy});
+
+            min_corner_ = Point(std::min(min_corner_.x, start.x), std::min(min_corner_.y, start.y));
+            max_corner_ = Point(std::max(max_corner_.x, start.x), std::max(max_corner_.y, start.y));
+        }
+    }
+
     void Zone::dump_config()
     {
         ESP_LOGCONFIG(TAG, "Zone: %s", name_);
-        ESP_LOGCONFIG(TAG, "  polygon_size: %i", polygon_.size());
-        ESP_LOGCONFIG(TAG, "  polygon valid: %s", is_convex(polygon_) ? "true" : "false");
+        if (shape_ == SHAPE_POLYGON)
+        {
+            ESP_LOGCONFIG(TAG, "  polygon_size: %i", polygon_.size());
+            ESP_LOGCONFIG(TAG, "  polygon valid: %s", is_convex(polygon_) ? "true" : "false");
+        }
+        else
+        {
+            ESP_LOGCONFIG(TAG, "  shape: %s", shape_ == SHAPE_CIRCLE ? "circle" : (shape_ == SHAPE_RING ? "ring" : "sector"));
+            ESP_LOGCONFIG(TAG, "  center: (%i, %i) mm", center_.x, center_.y);
+            ESP_LOGCONFIG(TAG, "  radius: %i - %i mm", int(inner_radius_), int(outer_radius_));
+        }
+        ESP_LOGCONFIG(TAG, "  margin: %i mm", margin_);
         if (template_polygon_ != nullptr)
         {
             ESP_LOGCONFIG(TAG, "  template polygon defined");
             ESP_LOGCONFIG(TAG, "  template polygon update interval: %i", int(template_evaluation_interval_));
         }
         ESP_LOGCONFIG(TAG, "  target_timeout: %i", int(target_timeout_));
+        if (on_delay_ != 0 || off_delay_ != 0 || min_dwell_ != 0)
+            ESP_LOGCONFIG(TAG, "  on_delay: %i, off_delay: %i, min_dwell: %i", int(on_delay_), int(off_delay_), int(min_dwell_));
 #ifdef USE_BINARY_SENSOR
         LOG_BINARY_SENSOR("  ", "OccupancyBinarySensor", occupancy_binary_sensor_);
 #endif
 #ifdef USE_SENSOR
         LOG_SENSOR("  ", "TargetCountSensor", target_count_sensor_);
+        LOG_SENSOR("  ", "DwellTimeSensor", dwell_time_sensor_);
+#endif
+    }
+
+    void Zone::publish_statistics()
+    {
+#ifdef USE_SENSOR
+        if (dwell_time_sensor_ != nullptr)
+            dwell_time_sensor_->publish_state(dwell_seconds_);
 #endif
     }
 
-    void Zone::update(std::vector<Target *> &targets, bool sensor_available)
+    void Zone::update(std::vector<Target *> &targets, bool sensor_available, uint32_t timestamp)
     {
         // evaluate custom template polygon at given interval
         if (template_evaluation_interval_ != 0 && millis() - last_template_evaluation_ > template_evaluation_interval_)
@@ -60,55 +172,147 @@ namespace esphome::ld2450
 
         if (!sensor_available)
         {
-#ifdef USE_BINARY_SENSOR
-            if (occupancy_binary_sensor_ != nullptr)
-                occupancy_binary_sensor_->publish_state(false);
-#endif
-#ifdef USE_SENSOR
-            if (target_count_sensor_ != nullptr)
-                target_count_sensor_->publish_state(NAN);
-#endif
+            // Targets are lost with the sensor, tracked targets leave the zone
+            for (uint8_t i = 0; i < ZONE_MAX_TARGETS; i++)
+            {
+                if (tracked_[i])
+                {
+                    tracked_[i] = false;
+                    queue_event(i, false, timestamp);
+                }
+            }
+            target_count_ = STATE_UNAVAILABLE;
+            raw_occupied_ = false;
+            occupied_ = false;
             return;
         }
 
-        if (polygon_.size() < 3)
+        if (!has_geometry())
             return;
 
+        // Accumulate the time the zone was occupied since the last update
+        if (target_count_ > 0)
+        {
+            uint32_t elapsed = dwell_remainder_ + (timestamp - last_update_);
+            dwell_seconds_ += elapsed / 1000;
+            dwell_remainder_ = elapsed % 1000;
+        }
+        last_update_ = timestamp;
+
         int target_count = 0;
-        for (Target *target : targets)
+        for (size_t i = 0; i < targets.size(); i++)
         {
-            target_count += contains_target(target);
+            target_count += contains_target(targets[i], i, timestamp);
         }
+        target_count_ = target_count;
+        debounce(target_count > 0, timestamp);
+    }
+
+    void Zone::debounce(bool raw_occupied, uint32_t timestamp)
+    {
+        if (raw_occupied != raw_occupied_)
+        {
+            raw_occupied_ = raw_occupied;
+            raw_changed_ = timestamp;
+        }
+
+        if (raw_occupied_ && !occupied_ && timestamp - raw_changed_ >= on_delay_)
+        {
+            occupied_ = true;
+            occupied_since_ = timestamp;
+        }
+        else if (!raw_occupied_ && occupied_ && timestamp - raw_changed_ >= off_delay_ && timestamp - occupied_since_ >= min_dwell_)
+        {
+            occupied_ = false;
+        }
+    }
+
+    void Zone::commit(int &publishes, int &unchanged)
+    {
+        ZoneEvent event;
+        while (events_.pop(event))
+        {
+            for (ZoneTrigger *trigger : event.entered ? enter_triggers_ : exit_triggers_)
+            {
+                trigger->trigger(event.target, event.timestamp);
+            }
+        }
+
+        if (target_count_ == STATE_UNKNOWN)
+            return;
 
 #ifdef USE_BINARY_SENSOR
         if (occupancy_binary_sensor_ != nullptr)
-            occupancy_binary_sensor_->publish_state(target_count > 0);
+        {
+            if (committed_target_count_ == STATE_UNKNOWN || committed_occupied_ != occupied_)
+            {
+                occupancy_binary_sensor_->publish_state(occupied_);
+                publishes++;
+            }
+            else
+            {
+                unchanged++;
+            }
+        }
 #endif
 #ifdef USE_SENSOR
-        if (target_count_sensor_ != nullptr && (target_count_sensor_->raw_state != target_count))
-            target_count_sensor_->publish_state(target_count);
+        if (target_count_sensor_ != nullptr)
+        {
+            if (committed_target_count_ != target_count_)
+            {
+                target_count_sensor_->publish_state(target_count_ == STATE_UNAVAILABLE ? NAN : target_count_);
+                publishes++;
+            }
+            else
+            {
+                unchanged++;
+            }
+        }
 #endif
+        committed_target_count_ = target_count_;
+        committed_occupied_ = occupied_;
     }
 
-    bool Zone::contains_target(Target *target)
+    void Zone::queue_event(uint8_t index, bool entered, uint32_t timestamp)
     {
-        if (polygon_.size() < 3)
+        if ((entered ? enter_triggers_ : exit_triggers_).empty())
+            return;
+        if (!events_.push({timestamp, index, entered}))
+            ESP_LOGW(TAG, "Zone %s: event queue full, dropping %s event of target %i", name_, entered ? "enter" : "exit", index);
+    }
+
+    bool Zone::contains_target(Target *target, uint8_t index, uint32_t timestamp)
+    {
+        if (!has_geometry() || index >= ZONE_MAX_TARGETS)
             return false;
 
         // Check if the target is already beeing tracked
-        bool is_tracked = tracked_targets_.count(target);
+        bool is_tracked = tracked_[index];
         if (!target->is_present())
         {
             if (!is_tracked)
             {
                 return false;
             }
+            else if (target->is_predicted())
+            {
+                // Predicted targets do not enter zones, but leave them once the predicted position is outside of the margin
+                bool within_margin = false;
+                contains_point(Point(target->get_x(), target->get_y()), true, within_margin);
+                if (!within_margin)
+                {
+                    tracked_[index] = false;
+                    queue_event(index, false, timestamp);
+                }
+                return within_margin;
+            }
             else
             {
                 // Remove from tracking list after timeout (target did not leave via polygon boundary)
-                if (millis() - tracked_targets_[target] > target_timeout_)
+                if (timestamp - last_seen_[index] > target_timeout_)
                 {
-                    tracked_targets_.erase(target);
+                    tracked_[index] = false;
+                    queue_event(index, false, timestamp);
                     return false;
                 }
                 else
@@ -121,19 +325,68 @@ namespace esphome::ld2450
 
         Point point = Point(target->get_x(), target->get_y());
 
-        int size = polygon_.size();
+        // Check if the target is inside of the zone or within the allowed margin, in case it is already tracked
+        bool within_margin = false;
+        bool is_inside = contains_point(point, is_tracked, within_margin);
+
+        // Track targets early if they are predicted to enter the zone. The current position must be within the margin,
+        // such that the target is not dropped again during the next update.
+        int16_t predicted_x, predicted_y;
+        if (!is_inside && !is_tracked && target->get_predicted_position(timestamp, predicted_x, predicted_y))
+        {
+            bool predicted_within_margin;
+            is_inside = contains_point(Point(predicted_x, predicted_y), false, predicted_within_margin);
+            if (is_inside)
+            {
+                contains_point(point, true, within_margin);
+                is_inside = within_margin;
+            }
+        }
+
+        if (is_inside && target->is_present())
+        {
+            // Add and Update last seen time
+            tracked_[index] = true;
+            last_seen_[index] = timestamp;
+            if (!is_tracked)
+                queue_event(index, true, timestamp);
+        }
+        else if (!is_tracked)
+        {
+            return false;
+        }
+        else if (!within_margin)
+        {
+            // Remove from target from tracking list
+            tracked_[index] = false;
+            queue_event(index, false, timestamp);
+            return false;
+        }
+        return true;
+    }
+
+    bool Zone::polygon_contains(Point point, bool is_tracked, bool &within_margin)
+    {
+        // Reject points outside of the bounding box (grown by the margin for tracked targets) without evaluating the edges
+        int margin = is_tracked ? margin_ : 0;
+        if (point.x < min_corner_.x - margin || point.x > max_corner_.x + margin ||
+            point.y < min_corner_.y - margin || point.y > max_corner_.y + margin)
+        {
+            within_margin = false;
+            return false;
+        }
+
+        int size = edges_.size();
         bool is_inside = true;
         int16_t min_distance = INT16_MAX;
         float last_cross_product = NAN;
-        // Check if the target is inside of the polygon or within the allowed margin, in case it is already tracked
         for (int i = 0; i < size + 1; i++)
         {
             // Check if the target point is on the same side of all edges within the polygon
-            int dx_1 = polygon_[(i + 1) % size].x - polygon_[i % size].x;
-            int dy_1 = polygon_[(i + 1) % size].y - polygon_[i % size].y;
-            int dx_2 = point.x - polygon_[i % size].x;
-            int dy_2 = point.y - polygon_[i % size].y;
-            float cross_product = dx_1 * dy_2 - dy_1 * dx_2;
+            const PolygonEdge &edge = edges_[i % size];
+            int dx_2 = point.x - edge.start.x;
+            int dy_2 = point.y - edge.start.y;
+            float cross_product = edge.dx * dy_2 - edge.dy * dx_2;
 
             if (!std::isnan(last_cross_product) && ((cross_product > 0 && last_cross_product < 0) || (cross_product > 0 && last_cross_product < 0)))
             {
@@ -147,8 +400,8 @@ namespace esphome::ld2450
             // Determine the targets distance to the polygon if tracked
             if (is_tracked)
             {
-                float dot_product = dx_1 * dx_2 + dy_1 * dy_2;
-                float r = dot_product / pow(sqrt(dx_1 * dx_1 + dy_1 * dy_1), 2);
+                float dot_product = edge.dx * dx_2 + edge.dy * dy_2;
+                float r = dot_product / edge.length_squared;
 
                 float distance;
                 if (r < 0)
@@ -157,37 +410,58 @@ namespace esphome::ld2450
                 }
                 else if (r > 1)
                 {
-                    int dx = polygon_[(i + 1) % size].x - point.x;
-                    int dy = polygon_[(i + 1) % size].y - point.y;
+                    int dx = edge.start.x + edge.dx - point.x;
+                    int dy = edge.start.y + edge.dy - point.y;
                     distance = sqrt(dx * dx + dy * dy);
                 }
                 else
                 {
                     float a = dx_2 * dx_2 + dy_2 * dy_2;
-                    float b = pow(sqrt(dx_1 * dx_1 + dy_1 * dy_1) * r, 2);
-                    distance = sqrt(a - b);
+                    float b = r * r * edge.length_squared;
+                    distance = sqrt(std::max(a - b, 0.0f));
                 }
                 min_distance = std::min(min_distance, int16_t(distance));
             }
         }
 
-        if (is_inside && target->is_present())
+        within_margin = is_inside || min_distance <= margin_;
+        return is_inside;
+    }
+
+    bool Zone::radial_contains(Point point, bool is_tracked, bool &within_margin)
+    {
+        // Squared distances exceed the int32_t range for radii or offsets above 46 m, e.g. for centers in room coordinates
+        int64_t dx = point.x - center_.x;
+        int64_t dy = point.y - center_.y;
+        int64_t distance_squared = dx * dx + dy * dy;
+
+        // Signed distances to the sector boundaries (scaled by SECTOR_DIRECTION_SCALE), positive values are outside
+        int64_t start_distance = 0;
+        int64_t end_distance = 0;
+        if (shape_ == SHAPE_SECTOR)
         {
-            // Add and Update last seen time
-            tracked_targets_[target] = millis();
+            start_distance = start_direction_.x * dy - start_direction_.y * dx;
+            end_distance = end_direction_.y * dx - end_direction_.x * dy;
         }
-        else if (is_tracked && !is_inside)
+
+        bool is_inside = distance_squared <= int64_t(outer_radius_) * outer_radius_ &&
+                         distance_squared >= int64_t(inner_radius_) * inner_radius_ &&
+                         start_distance <= 0 && end_distance <= 0;
+
+        if (is_inside || !is_tracked)
         {
-            // Check if the target is still within the margin of error
-            if (min_distance > margin_)
-            {
-                // Remove from target from tracking list
-                if (is_tracked)
-                    tracked_targets_.erase(target);
-                return false;
-            }
+            within_margin = is_inside;
+            return is_inside;
         }
-        return true;
+
+        // Grow the shape by the margin for already tracked targets
+        int64_t outer = outer_radius_ + margin_;
+        int64_t inner = std::max<int32_t>(inner_radius_ - margin_, 0);
+        int64_t scaled_margin = margin_ * SECTOR_DIRECTION_SCALE;
+        within_margin = distance_squared <= outer * outer &&
+                        distance_squared >= inner * inner &&
+                        start_distance <= scaled_margin && end_distance <= scaled_margin;
+        return false;
     }
 
     bool Zone::evaluate_template_polygon()
@@ -195,7 +469,12 @@ namespace esphome::ld2450
         if (template_polygon_ == nullptr)
             return false;
 
-        std::vector<Point> val = (template_polygon_)();
-        return update_polygon(val);
+        // The lambda returns a new vector on each evaluation, it is only copied into the zone if the polygon changed
+        std::vector<Point> polygon = (template_polygon_)();
+        if (shape_ == SHAPE_POLYGON && polygon.size() == polygon_.size() &&
+            std::equal(polygon.begin(), polygon.end(), polygon_.begin(), [](const Point &a, const Point &b)
+                       { return a.x == b.x && a.y == b.y; }))
+            return true;
+        return update_polygon(polygon);
     }
 } // namespace esphome::ld2450
\ No newline at end of file
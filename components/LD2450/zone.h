@@ -1,12 +1,26 @@
 #pragma once
-#include <map>
+#include "esphome/core/automation.h"
+#include "esphome/core/preferences.h"
 #include "target.h"
+#include "spsc_queue.h"
 #ifdef USE_BINARY_SENSOR
 #include "esphome/components/binary_sensor/binary_sensor.h"
 #endif
 #ifdef USE_BINARY_SENSOR
 #include "esphome/components/sensor/sensor.h"
 #endif
+
+#define SECTOR_DIRECTION_SCALE 1024
+
+#define STATE_UNKNOWN -2
+#define STATE_UNAVAILABLE -1
+
+#define ZONE_EVENT_QUEUE_SIZE 8
+#define ZONE_MAX_TARGETS 3
+
+#define ZONE_POLYGON_BLOB_VERSION 1
+#define ZONE_POLYGON_MAX_PERSISTED_POINTS 12
+
 namespace esphome::ld2450
 {
     /**
@@ -30,10 +44,72 @@ namespace esphome::ld2450
      * @brief Checks if the provided polygon is convex.
      * @return true if the polygon is convex, false otherwise.
      */
-    bool is_convex(std::vector<Point> polygon);
+    bool is_convex(const std::vector<Point> &polygon);
+
+    /**
+     * @brief Geometric primitive which describes the area of a zone.
+     */
+    enum ZoneShape
+    {
+        SHAPE_POLYGON,
+        SHAPE_CIRCLE,
+        SHAPE_RING,
+        SHAPE_SECTOR,
+    };
+    /**
+     * @brief Compact binary representation of a persisted zone polygon.
+     */
+    struct ZonePolygonBlob
+    {
+        /// @brief Format version, blobs of other versions are ignored
+        uint8_t version;
+
+        /// @brief Number of used points
+        uint8_t size;
+
+        /// @brief Points in mm
+        int16_t points[ZONE_POLYGON_MAX_PERSISTED_POINTS][2];
+    };
+
+    /**
+     * @brief Precomputed edge of a polygon.
+     */
+    struct PolygonEdge
+    {
+        /// @brief Start point of the edge
+        Point start;
+
+        /// @brief Direction of the edge (end - start)
+        int32_t dx, dy;
+
+        /// @brief Squared length of the edge
+        float length_squared;
+    };
 
     /**
-     * @brief Zones describe a phyiscal area, in which target are tracked. The area is given by a convex polygon.
+     * @brief Transition of a target into or out of a zone.
+     */
+    struct ZoneEvent
+    {
+        /// @brief Time of the frame in which the transition was detected (ms)
+        uint32_t timestamp;
+
+        /// @brief Index of the target (0-2)
+        uint8_t target;
+
+        /// @brief True if the target entered the zone, false if it left
+        bool entered;
+    };
+
+    /**
+     * @brief Trigger for zone entry and exit events, providing the index of the target and the frame timestamp in ms.
+     */
+    class ZoneTrigger : public Trigger<uint8_t, uint32_t>
+    {
+    };
+
+    /**
+     * @brief Zones describe a phyiscal area, in which target are tracked. The area is given by a convex polygon or an analytic shape (circle, ring or sector).
      */
     class Zone
     {
@@ -42,6 +118,7 @@ namespace esphome::ld2450
 #endif
 #ifdef USE_SENSOR
         SUB_SENSOR(target_count)
+        SUB_SENSOR(dwell_time)
 #endif
     public:
         /**
@@ -53,6 +130,15 @@ namespace esphome::ld2450
             name_ = name;
         }
 
+        /**
+         * @brief Sets the id of this zone, which is unique across all sensors unlike the name and identifies its preferences.
+         * @param id id of the zone within the configuration
+         */
+        void set_component_id(const char *id)
+        {
+            component_id_ = id;
+        }
+
         /**
          * @brief Sets the margin used on this zone.
          * @param margin margin in m
@@ -72,11 +158,82 @@ namespace esphome::ld2450
         }
 
         /**
-         * @brief Updates sensors related to this zone.
+         * @brief Enables restoring the polygon which was persisted with store_polygon(). Only applies to polygon zones.
+         * @param restore true if a persisted polygon should replace the configured polygon during setup
+         */
+        void set_restore_polygon(bool restore)
+        {
+            restore_polygon_ = restore;
+        }
+
+        /**
+         * @brief Restores the persisted polygon (if enabled) and builds the derived geometry. Called by the hub before the first frame is processed.
+         */
+        void setup();
+
+        /**
+         * @brief Sets the time a zone has to be continuously occupied before occupancy is reported.
+         * @param time time in ms
+         */
+        void set_on_delay(uint32_t time)
+        {
+            on_delay_ = time;
+        }
+
+        /**
+         * @brief Sets the time a zone has to be continuously empty before occupancy is cleared.
+         * @param time time in ms
+         */
+        void set_off_delay(uint32_t time)
+        {
+            off_delay_ = time;
+        }
+
+        /**
+         * @brief Sets the minimum time occupancy is reported once it was detected.
+         * @param time time in ms
+         */
+        void set_min_dwell(uint32_t time)
+        {
+            min_dwell_ = time;
+        }
+
+        /**
+         * @brief Computes the new state of this zone. Related sensors are not updated until the state is committed.
          * @param targets Reference to a vector of targets which will be used for calculation
          * @param available True if the sensor is currently available, false otherwise
+         * @param timestamp time of the processed frame in ms, used for debouncing the occupancy
          * */
-        void update(std::vector<Target *> &targets, bool sensor_available);
+        void update(std::vector<Target *> &targets, bool sensor_available, uint32_t timestamp);
+
+        /**
+         * @brief Adds a trigger which is fired whenever a target enters this zone.
+         */
+        void add_on_enter_trigger(ZoneTrigger *trigger)
+        {
+            enter_triggers_.push_back(trigger);
+        }
+
+        /**
+         * @brief Adds a trigger which is fired whenever a target leaves this zone.
+         */
+        void add_on_exit_trigger(ZoneTrigger *trigger)
+        {
+            exit_triggers_.push_back(trigger);
+        }
+
+        /**
+         * @brief Publishes the state computed by the last update, but only for sensors whose state has changed.
+         * Pending entry and exit events are delivered in the order they occurred.
+         * @param publishes incremented by the number of publish calls
+         * @param unchanged incremented by the number of sensors which were not published
+         */
+        void commit(int &publishes, int &unchanged);
+
+        /**
+         * @brief Publishes the accumulated dwell time. Called at the zone statistics interval of the hub.
+         */
+        void publish_statistics();
 
         /**
          * Logs the Zone configuration.
@@ -84,12 +241,39 @@ namespace esphome::ld2450
         void dump_config();
 
         /**
-         * Gets the occupancy status of this Zone.
+         * @brief Gets the name of this zone.
+         */
+        const char *get_name()
+        {
+            return name_;
+        }
+
+        /**
+         * @brief Gets the total time this zone was occupied.
+         * @return time in s
+         */
+        uint32_t get_dwell_time()
+        {
+            return dwell_seconds_;
+        }
+
+        /**
+         * @brief Checks if a target is currently tracked inside of this zone.
+         * @param index index of the target to check
+         * @return true if the target is tracked
+         */
+        bool is_tracking(uint8_t index)
+        {
+            return index < ZONE_MAX_TARGETS && tracked_[index];
+        }
+
+        /**
+         * Gets the (debounced) occupancy status of this Zone.
          * @return true, if at least one target is present in this zone.
          */
         bool is_occupied()
         {
-            return tracked_targets_.size() > 0;
+            return occupied_;
         }
 
         /**
@@ -98,7 +282,10 @@ namespace esphome::ld2450
          */
         uint8_t get_target_count()
         {
-            return tracked_targets_.size();
+            uint8_t count = 0;
+            for (bool tracked : tracked_)
+                count += tracked;
+            return count;
         }
 
         /**
@@ -108,22 +295,85 @@ namespace esphome::ld2450
          */
         void append_point(float x, float y)
         {
+            shape_ = SHAPE_POLYGON;
             polygon_.push_back(Point(int(x * 1000), int(y * 1000)));
         };
 
+        /**
+         * @brief Uses a circle as the area of this zone.
+         * @param x center x coordinate in m
+         * @param y center y coordinate in m
+         * @param radius radius in m
+         */
+        void set_circle(float x, float y, float radius)
+        {
+            set_ring(x, y, 0, radius);
+            shape_ = SHAPE_CIRCLE;
+        }
+
+        /**
+         * @brief Uses a ring (annulus) as the area of this zone.
+         * @param x center x coordinate in m
+         * @param y center y coordinate in m
+         * @param inner_radius inner radius in m
+         * @param outer_radius outer radius in m
+         */
+        void set_ring(float x, float y, float inner_radius, float outer_radius)
+        {
+            shape_ = SHAPE_RING;
+            center_ = Point(int(x * 1000), int(y * 1000));
+            inner_radius_ = int(inner_radius * 1000);
+            outer_radius_ = int(outer_radius * 1000);
+        }
+
+        /**
+         * @brief Uses an angular sector of a ring as the area of this zone. Angles are given like the target angle (0° is straight ahead, positive towards the positive x-axis).
+         * @param x center x coordinate in m
+         * @param y center y coordinate in m
+         * @param min_distance inner radius in m
+         * @param max_distance outer radius in m
+         * @param start_angle lower angle boundary in degrees
+         * @param end_angle upper angle boundary in degrees, at most 180° larger than the start angle
+         */
+        void set_sector(float x, float y, float min_distance, float max_distance, float start_angle, float end_angle)
+        {
+            set_ring(x, y, min_distance, max_distance);
+            shape_ = SHAPE_SECTOR;
+            // Boundary directions are computed once, such that containment checks only use cross products
+            start_direction_ = Point(int(sin(start_angle * M_PI / 180) * SECTOR_DIRECTION_SCALE), int(cos(start_angle * M_PI / 180) * SECTOR_DIRECTION_SCALE));
+            end_direction_ = Point(int(sin(end_angle * M_PI / 180) * SECTOR_DIRECTION_SCALE), int(cos(end_angle * M_PI / 180) * SECTOR_DIRECTION_SCALE));
+        }
+
+        /**
+         * @brief Gets the shape which describes the area of this zone.
+         */
+        ZoneShape get_shape()
+        {
+            return shape_;
+        }
+
         /**
          * @brief Updates the polygon of this zone.
          * @param polygon new convex polygon
          * @return true if the new polygon is convex, false otherwise
          */
-        bool update_polygon(std::vector<Point> polygon)
+        bool update_polygon(const std::vector<Point> &polygon)
         {
             if (!is_convex(polygon))
                 return false;
-            polygon_ = polygon;
+            shape_ = SHAPE_POLYGON;
+            polygon_.assign(polygon.begin(), polygon.end());
+            build_geometry();
             return true;
         }
 
+        /**
+         * @brief Updates the polygon of this zone and persists it, such that it is restored after a reboot.
+         * @param polygon new convex polygon with at most ZONE_POLYGON_MAX_PERSISTED_POINTS points, coordinates within the int16_t range
+         * @return true if the new polygon is valid, false otherwise
+         */
+        bool store_polygon(const std::vector<Point> &polygon);
+
         /**
          * @brief Defines a template polygon which will be evaluated regularly
          */
@@ -158,24 +408,186 @@ namespace esphome::ld2450
     protected:
         /**
          * @brief checks if a Target is contained within the zone
+         * @param target target to check
+         * @param index index of the target, used for entry and exit events
+         * @param timestamp time of the processed frame in ms
          * @return true if the target is currently tracked inside this zone.
          */
-        bool contains_target(Target *target);
+        bool contains_target(Target *target, uint8_t index, uint32_t timestamp);
+
+        /**
+         * @brief Queues an entry or exit event, if triggers are configured for it.
+         * @param index index of the target
+         * @param entered true if the target entered the zone
+         * @param timestamp time of the processed frame in ms
+         */
+        void queue_event(uint8_t index, bool entered, uint32_t timestamp);
+
+        /**
+         * @brief Precomputes edges and the bounding box of the polygon, which are used by polygon_contains().
+         */
+        void build_geometry();
+
+        /**
+         * @brief Creates the preference object used for persisting the polygon.
+         */
+        void make_preference();
+
+        /**
+         * @brief Determines whether the zone has a usable area.
+         * @return true if the polygon or analytic shape is defined
+         */
+        bool has_geometry()
+        {
+            if (shape_ == SHAPE_POLYGON)
+                return edges_.size() >= 3;
+            return outer_radius_ > 0;
+        }
+
+        /**
+         * @brief Applies on-delay, off-delay and minimum dwell time to the raw occupancy of this zone.
+         * @param raw_occupied true if at least one target is currently inside of the zone
+         * @param timestamp time of the processed frame in ms
+         */
+        void debounce(bool raw_occupied, uint32_t timestamp);
+
+        /**
+         * @brief Checks if a point is located within the area of this zone.
+         * @param point point to check
+         * @param is_tracked true if the margin around the area should be evaluated
+         * @param within_margin set to true if the point is located within the area or its margin
+         * @return true if the point is located inside of the area
+         */
+        bool contains_point(Point point, bool is_tracked, bool &within_margin)
+        {
+            if (shape_ == SHAPE_POLYGON)
+                return polygon_contains(point, is_tracked, within_margin);
+            return radial_contains(point, is_tracked, within_margin);
+        }
+
+        /**
+         * @brief Checks if a point is located within the polygon of this zone.
+         * @param point point to check
+         * @param is_tracked true if the margin around the polygon should be evaluated
+         * @param within_margin set to true if the point is located within the polygon or its margin
+         * @return true if the point is located inside of the polygon
+         */
+        bool polygon_contains(Point point, bool is_tracked, bool &within_margin);
+
+        /**
+         * @brief Checks if a point is located within the circle, ring or sector of this zone using squared distances and cross products.
+         * @param point point to check
+         * @param is_tracked true if the margin around the shape should be evaluated
+         * @param within_margin set to true if the point is located within the shape or its margin
+         * @return true if the point is located inside of the shape
+         */
+        bool radial_contains(Point point, bool is_tracked, bool &within_margin);
 
         /// @brief Name of this zone
         const char *name_ = "Unnamed Zone";
 
+        /// @brief Id of this zone, the name is used for preference keys if not set
+        const char *component_id_ = nullptr;
+
+        /// @brief Shape which describes the area of this zone
+        ZoneShape shape_ = SHAPE_POLYGON;
+
         /// @brief List of points which make up a convex polygon
         std::vector<Point> polygon_{};
 
+        /// @brief Precomputed edges of the polygon
+        std::vector<PolygonEdge> edges_{};
+
+        /// @brief Bounding box of the polygon in mm
+        Point min_corner_{};
+        Point max_corner_{};
+
+        /// @brief Determines whether a persisted polygon is restored
+        bool restore_polygon_ = false;
+
+        /// @brief Preference object used for persisting the polygon
+        ESPPreferenceObject pref_;
+
+        /// @brief True once the preference object was created
+        bool has_pref_ = false;
+
+        /// @brief Key of the preference object, derived from the name during setup
+        uint32_t pref_key_ = 0;
+
+        /// @brief Center of circle, ring and sector shapes in mm
+        Point center_{};
+
+        /// @brief Inner radius of ring and sector shapes in mm
+        int32_t inner_radius_ = 0;
+
+        /// @brief Outer radius of circle, ring and sector shapes in mm
+        int32_t outer_radius_ = 0;
+
+        /// @brief Direction of the lower sector boundary, scaled by SECTOR_DIRECTION_SCALE
+        Point start_direction_{};
+
+        /// @brief Direction of the upper sector boundary, scaled by SECTOR_DIRECTION_SCALE
+        Point end_direction_{};
+
         /// @brief Margin around the polygon in mm, in which existing targets are tracked further
         uint16_t margin_ = 250;
 
         /// @brief timeout after which a target within the is considered absent
         int target_timeout_ = 5000;
 
-        /// @brief Map of targets which are currently tracked inside of this polygon with their last seen timestamp
-        std::map<Target *, uint32_t> tracked_targets_{};
+        /// @brief Time the zone has to be occupied before occupancy is reported in ms
+        uint32_t on_delay_ = 0;
+
+        /// @brief Time the zone has to be empty before occupancy is cleared in ms
+        uint32_t off_delay_ = 0;
+
+        /// @brief Minimum time occupancy is reported in ms
+        uint32_t min_dwell_ = 0;
+
+        /// @brief Raw (un-debounced) occupancy of the last update
+        bool raw_occupied_ = false;
+
+        /// @brief Timestamp of the last change of the raw occupancy
+        uint32_t raw_changed_ = 0;
+
+        /// @brief Debounced occupancy computed by the last update
+        bool occupied_ = false;
+
+        /// @brief Timestamp at which the debounced occupancy was last set
+        uint32_t occupied_since_ = 0;
+
+        /// @brief Debounced occupancy which was last published
+        bool committed_occupied_ = false;
+
+        /// @brief Number of targets computed by the last update or STATE_UNAVAILABLE
+        int target_count_ = STATE_UNKNOWN;
+
+        /// @brief Total time this zone was occupied in whole seconds, which does not wrap like a ms counter after 49.7 days
+        uint32_t dwell_seconds_ = 0;
+
+        /// @brief Occupied time in ms which is not yet accounted in dwell_seconds_
+        uint16_t dwell_remainder_ = 0;
+
+        /// @brief Timestamp of the last update while the sensor was available
+        uint32_t last_update_ = 0;
+
+        /// @brief Number of targets which was last published or STATE_UNKNOWN
+        int committed_target_count_ = STATE_UNKNOWN;
+
+        /// @brief Targets (by index) which are currently tracked inside of this polygon
+        bool tracked_[ZONE_MAX_TARGETS] = {false};
+
+        /// @brief Last seen timestamp of each tracked target
+        uint32_t last_seen_[ZONE_MAX_TARGETS] = {0};
+
+        /// @brief Triggers fired when a target enters the zone
+        std::vector<ZoneTrigger *> enter_triggers_{};
+
+        /// @brief Triggers fired when a target leaves the zone
+        std::vector<ZoneTrigger *> exit_triggers_{};
+
+        /// @brief Entry and exit events which have not been delivered yet
+        SpscQueue<ZoneEvent, ZONE_EVENT_QUEUE_SIZE> events_{};
 
         /// @brief Template polygon function
         std::function<std::vector<Point>()> template_polygon_ = nullptr;
@@ -197,11 +609,15 @@ namespace esphome::ld2450
         }
 
         TEMPLATABLE_VALUE(std::vector<Point>, polygon)
+        TEMPLATABLE_VALUE(bool, persist)
 
         void play(const Ts &...x) override
         {
             std::vector<Point> polygon = this->polygon_.value(x...);
-            this->parent_->update_polygon(polygon);
+            if (this->persist_.value(x...))
+                this->parent_->store_polygon(polygon);
+            else
+                this->parent_->update_polygon(polygon);
         }
 
         Zone *parent_;
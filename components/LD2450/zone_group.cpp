@@ -0,0 +1,53 @@
+#include "zone_group.h"
+
+namespace esphome::ld2450
+{
+    static const char *TAG = "ZoneGroup";
+
+    void ZoneGroup::dump_config()
+    {
+        ESP_LOGCONFIG(TAG, "Zone group: %s", name_);
+        ESP_LOGCONFIG(TAG, "  zone mask: 0x%08X", unsigned(zone_mask_));
+#ifdef USE_BINARY_SENSOR
+        LOG_BINARY_SENSOR("  ", "OccupancyBinarySensor", occupancy_binary_sensor_);
+#endif
+#ifdef USE_SENSOR
+        LOG_SENSOR("  ", "OccupiedZonesSensor", occupied_zones_sensor_);
+#endif
+    }
+
+    void ZoneGroup::commit(uint32_t occupied_mask, bool sensor_available, int &publishes, int &unchanged)
+    {
+        int zone_count = sensor_available ? __builtin_popcount(occupied_mask & zone_mask_) : STATE_UNAVAILABLE;
+
+#ifdef USE_BINARY_SENSOR
+        if (occupancy_binary_sensor_ != nullptr)
+        {
+            if (committed_zone_count_ == STATE_UNKNOWN || (committed_zone_count_ > 0) != (zone_count > 0))
+            {
+                occupancy_binary_sensor_->publish_state(zone_count > 0);
+                publishes++;
+            }
+            else
+            {
+                unchanged++;
+            }
+        }
+#endif
+#ifdef USE_SENSOR
+        if (occupied_zones_sensor_ != nullptr)
+        {
+            if (committed_zone_count_ != zone_count)
+            {
+                occupied_zones_sensor_->publish_state(zone_count == STATE_UNAVAILABLE ? NAN : zone_count);
+                publishes++;
+            }
+            else
+            {
+                unchanged++;
+            }
+        }
+#endif
+        committed_zone_count_ = zone_count;
+    }
+} // namespace esphome::ld2450
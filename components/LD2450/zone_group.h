@@ -0,0 +1,89 @@
+#pragma once
+#include "esphome/core/component.h"
+#include "zone.h"
+#ifdef USE_BINARY_SENSOR
+#include "esphome/components/binary_sensor/binary_sensor.h"
+#endif
+#ifdef USE_SENSOR
+#include "esphome/components/sensor/sensor.h"
+#endif
+
+#define MAX_GROUPED_ZONES 32
+
+namespace esphome::ld2450
+{
+    /**
+     * @brief Zone groups aggregate the occupancy of several zones of the same hub. Membership is stored as a bitmask of zone indices,
+     * such that the group state is derived from the hub's occupied zone mask by a single AND and popcount.
+     */
+    class ZoneGroup
+    {
+#ifdef USE_BINARY_SENSOR
+        SUB_BINARY_SENSOR(occupancy)
+#endif
+#ifdef USE_SENSOR
+        SUB_SENSOR(occupied_zones)
+#endif
+    public:
+        /**
+         * @brief Update the name of this zone group.
+         * @param name new name
+         */
+        void set_name(const char *name)
+        {
+            name_ = name;
+        }
+
+        /**
+         * @brief Adds a zone to this group.
+         * @param index index of the zone within the zones of the hub
+         */
+        void add_zone(uint8_t index)
+        {
+            if (index < MAX_GROUPED_ZONES)
+                zone_mask_ |= uint32_t(1) << index;
+        }
+
+        /**
+         * @brief Publishes the state of this group, but only for sensors whose state has changed.
+         * @param occupied_mask bitmask of currently occupied zones
+         * @param sensor_available True if the sensor is currently available, false otherwise
+         * @param publishes incremented by the number of publish calls
+         * @param unchanged incremented by the number of sensors which were not published
+         */
+        void commit(uint32_t occupied_mask, bool sensor_available, int &publishes, int &unchanged);
+
+        /**
+         * Logs the zone group configuration.
+         */
+        void dump_config();
+
+        /**
+         * Gets the occupancy status of this zone group.
+         * @return true, if at least one zone of this group is occupied.
+         */
+        bool is_occupied()
+        {
+            return committed_zone_count_ > 0;
+        }
+
+        /**
+         * @brief Gets the number of occupied zones of this group.
+         * @return number of zones or STATE_UNAVAILABLE / STATE_UNKNOWN
+         */
+        int get_occupied_zones()
+        {
+            return committed_zone_count_;
+        }
+
+    protected:
+        /// @brief Name of this zone group
+        const char *name_ = "Unnamed Zone Group";
+
+        /// @brief Bitmask of the zones which are part of this group
+        uint32_t zone_mask_ = 0;
+
+        /// @brief Number of occupied zones which was last published, STATE_UNAVAILABLE or STATE_UNKNOWN
+        int committed_zone_count_ = STATE_UNKNOWN;
+    };
+} // namespace esphome::ld2450
@@ -0,0 +1,210 @@
+#include <cmath>
+#include <cstdlib>
+#include <new>
+#include "hub_test.h"
+
+#if defined(__GNUC__) && !defined(__clang__)
+// The replaced operators below pair malloc and free, GCC does not see through the replacement
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+// Counts heap allocations while enabled. All variants of operator new end up in the replaced basic operator.
+static bool counting = false;
+static size_t allocations = 0;
+
+void *operator new(size_t size)
+{
+    if (counting)
+        allocations++;
+    void *pointer = malloc(size > 0 ? size : 1);
+    if (pointer == nullptr)
+        throw std::bad_alloc();
+    return pointer;
+}
+
+void *operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void *pointer) noexcept
+{
+    free(pointer);
+}
+
+void operator delete[](void *pointer) noexcept
+{
+    free(pointer);
+}
+
+void operator delete(void *pointer, size_t) noexcept
+{
+    free(pointer);
+}
+
+void operator delete[](void *pointer, size_t) noexcept
+{
+    free(pointer);
+}
+
+#define FRAME_INTERVAL 100
+
+/**
+ * Position of a simulated person, walking on a circle through all zones.
+ */
+static Slot person(int index, uint32_t time)
+{
+    float phase = time / 4000.0f + index * 2.1f;
+    int16_t x = int16_t(1500 * cosf(phase));
+    int16_t y = int16_t(2500 + 1200 * sinf(phase));
+    return {x, y, int16_t(40 * sinf(phase)), 360};
+}
+
+int main()
+{
+    testing::set_millis(1000);
+    HubFixture fixture;
+    LD2450 &hub = fixture.hub;
+
+    // Configuration with all processing stages that run per frame
+    Target targets[3];
+    PollingSensor target_sensors[3][8];
+    binary_sensor::BinarySensor stationary[3];
+    for (int i = 0; i < 3; i++)
+    {
+        targets[i].set_debugging(i == 0);
+        targets[i].set_x_position_sensor(&target_sensors[i][0]);
+        targets[i].set_y_position_sensor(&target_sensors[i][1]);
+        targets[i].set_speed_sensor(&target_sensors[i][2]);
+        targets[i].set_distance_resolution_sensor(&target_sensors[i][3]);
+        targets[i].set_angle_sensor(&target_sensors[i][4]);
+        targets[i].set_distance_sensor(&target_sensors[i][5]);
+        targets[i].set_heading_sensor(&target_sensors[i][6]);
+        targets[i].set_radial_velocity_sensor(&target_sensors[i][7]);
+        targets[i].set_stationary_binary_sensor(&stationary[i]);
+        hub.register_target(&targets[i]);
+    }
+
+    Zone polygon_zone, circle_zone, sector_zone;
+    binary_sensor::BinarySensor zone_occupancy[3];
+    sensor::Sensor zone_counts[3], dwell_times[3];
+    ZoneTrigger enter_trigger, exit_trigger;
+    polygon_zone.set_name("Polygon");
+    polygon_zone.append_point(-1.5f, 1.0f);
+    polygon_zone.append_point(0.0f, 1.0f);
+    polygon_zone.append_point(0.0f, 3.0f);
+    polygon_zone.append_point(-1.5f, 3.0f);
+    polygon_zone.add_on_enter_trigger(&enter_trigger);
+    polygon_zone.add_on_exit_trigger(&exit_trigger);
+    circle_zone.set_name("Circle");
+    circle_zone.set_circle(1.0f, 2.5f, 1.0f);
+    circle_zone.set_on_delay(200);
+    circle_zone.set_off_delay(500);
+    sector_zone.set_name("Sector");
+    sector_zone.set_sector(0.0f, 0.0f, 1.0f, 4.0f, -30.0f, 30.0f);
+    Zone *zones[3] = {&polygon_zone, &circle_zone, &sector_zone};
+    for (int i = 0; i < 3; i++)
+    {
+        zones[i]->set_occupancy_binary_sensor(&zone_occupancy[i]);
+        zones[i]->set_target_count_sensor(&zone_counts[i]);
+        zones[i]->set_dwell_time_sensor(&dwell_times[i]);
+        hub.register_zone(zones[i]);
+    }
+
+    ZoneGroup group;
+    binary_sensor::BinarySensor group_occupancy;
+    group.set_name("Group");
+    group.add_zone(0);
+    group.add_zone(1);
+    group.set_occupancy_binary_sensor(&group_occupancy);
+    hub.register_zone_group(&group);
+
+    sensor::Sensor transitions;
+    hub.add_transition_sensor(0, 1, &transitions);
+
+    CrossingLine line;
+    sensor::Sensor line_in, line_out;
+    line.set_name("Line");
+    line.set_line(0.0f, 1.0f, 0.0f, 4.0f);
+    line.set_in_count_sensor(&line_in);
+    line.set_out_count_sensor(&line_out);
+    hub.register_crossing_line(&line);
+
+    Heatmap heatmap;
+    heatmap.set_dimensions(6.0f, 6.0f, 0.25f);
+    hub.set_heatmap(&heatmap);
+
+    InterferenceMask mask;
+    mask.set_dimensions(6.0f, 6.0f, 0.25f);
+    mask.add_region();
+    mask.append_point(2.5f, 5.0f);
+    mask.append_point(3.0f, 5.0f);
+    mask.append_point(3.0f, 5.5f);
+    mask.set_learning(60000);
+    hub.set_interference_mask(&mask);
+
+    LatencyMonitor latency;
+    sensor::Sensor latency_sensors[4];
+    latency.set_queue_sensor(&latency_sensors[0]);
+    latency.set_processing_sensor(&latency_sensors[1]);
+    latency.set_publish_sensor(&latency_sensors[2]);
+    latency.set_end_to_end_sensor(&latency_sensors[3]);
+    hub.set_latency_monitor(&latency);
+
+    TraceBuffer trace;
+    hub.set_trace(&trace);
+
+    sensor::Sensor target_count;
+    hub.set_target_count_sensor(&target_count);
+    hub.set_target_association(true);
+    hub.set_prediction(0.8f, 0.3f, 3, 200);
+    hub.set_max_publish_rate(20);
+    hub.set_mounting_pose(0.1f, 0.0f, 5.0f);
+
+    hub.setup();
+
+    // Finish the startup config session and warm up all one-time paths (first occupancy, publish schedules)
+    uint32_t time = 0;
+    auto run_frames = [&](int count)
+    {
+        for (int n = 0; n < count; n++)
+        {
+            Slot slots[3] = {person(0, time), person(1, time), {}};
+            // Dropouts and a third person appearing and leaving again
+            if (n % 17 == 0)
+                slots[1] = {};
+            if ((n / 50) % 2 == 1)
+                slots[2] = person(2, time);
+            fixture.send_frame(slots);
+            fixture.run(FRAME_INTERVAL);
+            time += FRAME_INTERVAL;
+        }
+    };
+    fixture.send_ack(COMMAND_ENTER_CONFIG);
+    fixture.run(200);
+    fixture.send_ack(COMMAND_READ_TRACKING_MODE, (const uint8_t[]){0x02, 0x00}, 2);
+    fixture.run(200);
+    fixture.send_ack(COMMAND_READ_MAC, (const uint8_t[]){0x8F, 0x27, 0x2E, 0xB8, 0x0F, 0x65}, 6);
+    fixture.run(200);
+    fixture.send_ack(COMMAND_READ_VERSION, (const uint8_t[]){0x00, 0x01, 0x02, 0x16, 0x24, 0x06, 0x22, 0x01}, 8);
+    fixture.run(200);
+    fixture.send_ack(COMMAND_LEAVE_CONFIG);
+    run_frames(200);
+    CHECK(hub.is_sensor_available());
+
+    // Steady state: streaming targets through zones, lines, heatmap, mask, trace and periodic statistics
+    counting = true;
+    run_frames(3000);
+    counting = false;
+
+    CHECK(hub.is_sensor_available());
+    CHECK(enter_trigger.triggered > 0);
+    CHECK(line_in.publishes + line_out.publishes > 0);
+    if (allocations != 0)
+    {
+        fprintf(stderr, "allocation_test: %u heap allocations during steady-state processing\n", unsigned(allocations));
+        return 1;
+    }
+    printf("allocation_test: passed\n");
+    return 0;
+}
@@ -0,0 +1,165 @@
+#include "hub_test.h"
+
+/**
+ * Sensor which only communicates at a single baud rate, the bytes received at any other baud rate of the UART are garbage.
+ * Commands are acknowledged and baud rate changes are applied on restart, like on the real sensor.
+ */
+struct FakeSensor
+{
+    FakeSensor(HubFixture &fixture, uint32_t baud_rate)
+        : fixture(fixture), baud_rate(baud_rate)
+    {
+    }
+
+    /// @brief Runs the hub and the sensor for the given time in steps of 1 ms
+    void run(uint32_t duration)
+    {
+        for (uint32_t i = 0; i < duration; i++)
+        {
+            fixture.hub.loop();
+            respond();
+            testing::advance(1);
+            time++;
+        }
+    }
+
+    void respond()
+    {
+        bool matched = fixture.uart.get_baud_rate() == baud_rate;
+        if (time % FRAME_INTERVAL == 0)
+        {
+            if (matched)
+            {
+                const Slot slots[3] = {{0, 2000, 0, 360}, {}, {}};
+                fixture.send_frame(slots);
+            }
+            else
+            {
+                // Mismatched bit timing produces arbitrary bytes
+                uint8_t garbage[DATA_FRAME_SIZE];
+                for (size_t i = 0; i < sizeof(garbage); i++)
+                    garbage[i] = uint8_t(time * 131 + i * 197);
+                fixture.uart.receive(garbage, sizeof(garbage));
+            }
+        }
+
+        // Commands are only understood at the matching baud rate: header (4), length (2), command word (2) and value
+        const std::vector<uint8_t> &tx = fixture.uart.tx;
+        for (size_t i = 0; matched && i + 8 < tx.size(); i++)
+        {
+            if (tx[i] != 0xFD || tx[i + 1] != 0xFC || tx[i + 2] != 0xFB || tx[i + 3] != 0xFA)
+                continue;
+            uint8_t word = tx[i + 6];
+            commands.push_back(word);
+            if (word == COMMAND_SET_BAUD_RATE)
+                pending_baud_rate = baud_rate_to_int(BaudRate(tx[i + 8]));
+            fixture.send_ack(word);
+            if (word == COMMAND_RESTART && pending_baud_rate != 0)
+            {
+                baud_rate = pending_baud_rate;
+                pending_baud_rate = 0;
+            }
+        }
+        fixture.uart.tx.clear();
+    }
+
+    bool received(uint8_t word) const
+    {
+        for (uint8_t command : commands)
+        {
+            if (command == word)
+                return true;
+        }
+        return false;
+    }
+
+    static const uint32_t FRAME_INTERVAL = 100;
+
+    HubFixture &fixture;
+    uint32_t baud_rate;
+    uint32_t pending_baud_rate = 0;
+    uint32_t time = 0;
+    std::vector<uint8_t> commands;
+};
+
+// The probe sequence skips the configured baud rate and stops at the first candidate at which frames are received
+static void test_detects_baud_rate()
+{
+    testing::set_millis(1000);
+    HubFixture fixture;
+    BaudRateSelect select;
+    fixture.hub.set_baud_rate_select(&select);
+    fixture.hub.set_auto_baud_rate(false);
+    fixture.hub.set_fast_startup(true);
+    fixture.uart.set_baud_rate(256000);
+    fixture.hub.setup();
+
+    FakeSensor sensor(fixture, 115200);
+    // 460800 and 115200 are probed once no valid message was received, 256000 has already failed
+    sensor.run(SENSOR_UNAVAILABLE_TIMEOUT + 3 * AUTO_BAUD_PROBE_TIME);
+    CHECK_EQ(fixture.uart.get_baud_rate(), 115200);
+    CHECK_EQ(fixture.uart.settings_loaded, 2);
+    CHECK(select.state == "115200");
+
+    sensor.run(1000);
+    CHECK(fixture.hub.is_sensor_available());
+    CHECK_EQ(fixture.uart.get_baud_rate(), 115200);
+    CHECK_EQ(fixture.uart.settings_loaded, 2);
+    CHECK(!sensor.received(COMMAND_SET_BAUD_RATE));
+}
+
+// Without any answering baud rate, the configured baud rate is restored and probing is retried after a pause
+static void test_restores_baud_rate()
+{
+    testing::set_millis(1000);
+    HubFixture fixture;
+    fixture.hub.set_auto_baud_rate(false);
+    fixture.hub.set_fast_startup(true);
+    fixture.uart.set_baud_rate(256000);
+    fixture.hub.setup();
+
+    FakeSensor sensor(fixture, 0);
+    sensor.run(SENSOR_UNAVAILABLE_TIMEOUT + 100 + 8 * AUTO_BAUD_PROBE_TIME);
+    CHECK_EQ(fixture.uart.get_baud_rate(), 256000);
+    int loaded = fixture.uart.settings_loaded;
+    CHECK_EQ(loaded, 8);
+
+    // Sensor starts answering at another baud rate, which is found by the next cycle
+    sensor.baud_rate = 9600;
+    sensor.run(AUTO_BAUD_RETRY_INTERVAL / 2);
+    CHECK_EQ(fixture.uart.settings_loaded, loaded);
+    sensor.run(AUTO_BAUD_RETRY_INTERVAL / 2 + 8 * AUTO_BAUD_PROBE_TIME + 1000);
+    CHECK_EQ(fixture.uart.get_baud_rate(), 9600);
+    CHECK(fixture.hub.is_sensor_available());
+}
+
+// A detected sensor is moved to 460800 baud, the UART follows once the restart is acknowledged
+static void test_upgrades_baud_rate()
+{
+    testing::set_millis(1000);
+    HubFixture fixture;
+    fixture.hub.set_auto_baud_rate(true);
+    fixture.hub.set_fast_startup(true);
+    fixture.uart.set_baud_rate(256000);
+    fixture.hub.setup();
+
+    FakeSensor sensor(fixture, 256000);
+    sensor.run(5000);
+    CHECK(sensor.received(COMMAND_SET_BAUD_RATE));
+    CHECK(sensor.received(COMMAND_RESTART));
+    CHECK_EQ(sensor.baud_rate, 460800);
+    CHECK_EQ(fixture.uart.get_baud_rate(), 460800);
+
+    sensor.run(SENSOR_UNAVAILABLE_TIMEOUT + 1000);
+    CHECK(fixture.hub.is_sensor_available());
+    CHECK_EQ(fixture.uart.get_baud_rate(), 460800);
+}
+
+int main()
+{
+    test_detects_baud_rate();
+    test_restores_baud_rate();
+    test_upgrades_baud_rate();
+    printf("auto_baud_test: passed\n");
+    return 0;
+}
@@ -0,0 +1,91 @@
+"""Decode frames of tools/generate_frames.py with the component and compare the targets.
+
+Usage:
+    python3 tests/host/check_generated_frames.py tests/host/build/frame_replay
+
+Random walks with slot swaps and dropouts are generated for a fixed seed, replayed
+through the UART of the hub by frame_replay and compared frame by frame against
+the reference decoder of the generator.
+"""
+
+import os
+import subprocess
+import sys
+import tempfile
+
+TOOLS = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..", "tools")
+sys.path.insert(0, TOOLS)
+
+from generate_frames import (  # noqa: E402  pylint: disable=wrong-import-position
+    FRAME_SIZE,
+    decode_frame,
+)
+
+GENERATOR_ARGS = [
+    "--people",
+    "3",
+    "--duration",
+    "120",
+    "--dwell",
+    "10",
+    "--absence",
+    "3",
+    "--swap-probability",
+    "0.05",
+    "--dropout-probability",
+    "0.05",
+    "--seed",
+    "2450",
+    "--speedup",
+    "0",
+]
+
+
+def format_frame(targets):
+    """Format decoded slots like frame_replay."""
+    return "; ".join(
+        "-" if target is None else " ".join(str(value) for value in target)
+        for target in targets
+    )
+
+
+def main():
+    """Entry point."""
+    if len(sys.argv) != 2:
+        sys.exit(__doc__)
+
+    with tempfile.TemporaryDirectory() as directory:
+        path = os.path.join(directory, "frames.bin")
+        subprocess.run(
+            [
+                sys.executable,
+                os.path.join(TOOLS, "generate_frames.py"),
+                *GENERATOR_ARGS,
+                "--output",
+                path,
+            ],
+            check=True,
+        )
+        with open(path, "rb") as file:
+            data = file.read()
+        replay = subprocess.run(
+            [sys.argv[1], path], check=True, capture_output=True, text=True
+        )
+
+    frames = [
+        decode_frame(data[offset : offset + FRAME_SIZE])
+        for offset in range(0, len(data), FRAME_SIZE)
+    ]
+    expected = [format_frame(targets) for targets in frames]
+    actual = replay.stdout.splitlines()
+    if len(actual) != len(expected):
+        sys.exit(f"Decoded {len(actual)} frames, expected {len(expected)}.")
+    for number, (line, reference) in enumerate(zip(actual, expected)):
+        if line != reference:
+            sys.exit(f"Frame {number}: decoded '{line}', expected '{reference}'.")
+    targets = sum(target is not None for targets in frames for target in targets)
+    print(f"check_generated_frames: {len(expected)} frames, {targets} targets passed")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,143 @@
+#include <cstring>
+#include "hub_test.h"
+
+/**
+ * Runs the hub with a sensor which acknowledges every command, until the command queue is drained.
+ * @return number of command words stored in words
+ */
+static size_t run_acknowledged(HubFixture &fixture, uint8_t *words, size_t max_words)
+{
+    size_t count = 0;
+    for (int step = 0; step < 200 && count < max_words; step++)
+    {
+        fixture.uart.tx.clear();
+        fixture.run(50);
+        uint8_t sent[4];
+        size_t sent_count = sent_commands(fixture.uart, sent, 4);
+        for (size_t i = 0; i < sent_count && count < max_words; i++)
+        {
+            words[count++] = sent[i];
+            fixture.send_ack(sent[i]);
+        }
+    }
+    return count;
+}
+
+static bool contains(const uint8_t *words, size_t count, uint8_t word)
+{
+    return memchr(words, word, count) != nullptr;
+}
+
+// Back-to-back user actions are queued behind the startup reads, an action which does not fit is rejected completely
+static void test_sequences_are_atomic()
+{
+    testing::set_millis(1000);
+    HubFixture fixture;
+    BluetoothSwitch bluetooth_switch;
+    BaudRateSelect select;
+    fixture.hub.set_bluetooth_switch(&bluetooth_switch);
+    fixture.hub.set_baud_rate_select(&select);
+    fixture.hub.setup();
+    select.publish_state("256000");
+    testing::clear_warning();
+
+    // Startup reads (3), the factory reset (4) and the bluetooth change (4) fit next to enter and leave config
+    fixture.hub.perform_factory_reset();
+    fixture.hub.set_bluetooth_state(false);
+    CHECK_EQ(strlen(testing::last_warning()), 0);
+
+    // Neither the baud rate command nor the restart which applies it are queued, the select reverts to its state
+    int published = select.publish_count;
+    fixture.hub.set_baud_rate(BAUD_115200);
+    CHECK(strstr(testing::last_warning(), "dropping baud rate change") != nullptr);
+    CHECK_EQ(select.publish_count, published + 1);
+    CHECK(select.state == "256000");
+
+    uint8_t words[64];
+    size_t count = run_acknowledged(fixture, words, 64);
+    CHECK(contains(words, count, COMMAND_FACTORY_RESET));
+    CHECK(contains(words, count, COMMAND_BLUETOOTH));
+    CHECK(contains(words, count, COMMAND_RESTART));
+    CHECK(contains(words, count, COMMAND_LEAVE_CONFIG));
+    CHECK(!contains(words, count, COMMAND_SET_BAUD_RATE));
+
+    // The queue accepts actions again once drained
+    testing::clear_warning();
+    fixture.hub.set_baud_rate(BAUD_115200);
+    CHECK_EQ(strlen(testing::last_warning()), 0);
+    count = run_acknowledged(fixture, words, 64);
+    CHECK(contains(words, count, COMMAND_SET_BAUD_RATE));
+    CHECK(contains(words, count, COMMAND_RESTART));
+}
+
+// A rejected switch change republishes the previous state of the switch
+static void test_rejected_switch_reverts()
+{
+    testing::set_millis(1000);
+    HubFixture fixture;
+    BluetoothSwitch bluetooth_switch;
+    TrackingModeSwitch tracking_mode_switch;
+    fixture.hub.set_bluetooth_switch(&bluetooth_switch);
+    fixture.hub.set_tracking_mode_switch(&tracking_mode_switch);
+    fixture.hub.setup();
+    bluetooth_switch.publish_state(true);
+    tracking_mode_switch.publish_state(true);
+
+    // Startup reads (3), two factory resets (4 each) and a restart (3) leave no room next to enter and leave config
+    fixture.hub.perform_factory_reset();
+    fixture.hub.perform_factory_reset();
+    fixture.hub.perform_restart();
+    fixture.hub.set_bluetooth_state(false);
+    CHECK(bluetooth_switch.state);
+    CHECK_EQ(bluetooth_switch.publish_count, 2);
+    fixture.hub.set_tracking_mode(false);
+    CHECK(tracking_mode_switch.state);
+    CHECK_EQ(tracking_mode_switch.publish_count, 2);
+}
+
+/**
+ * Starts a hub which caches its settings and runs it with an acknowledging sensor in multi target tracking mode.
+ * @return true if the hub read the tracking mode from the sensor instead of the cache
+ */
+static bool start_cached_hub(const char *id)
+{
+    HubFixture fixture;
+    fixture.hub.set_component_id(id);
+    fixture.hub.set_cache_settings(true);
+    fixture.hub.setup();
+
+    bool read = false;
+    for (int step = 0; step < 40; step++)
+    {
+        fixture.uart.tx.clear();
+        fixture.run(50);
+        uint8_t words[4];
+        size_t count = sent_commands(fixture.uart, words, 4);
+        for (size_t i = 0; i < count; i++)
+        {
+            const uint8_t mode[2] = {0x02, 0x00};
+            if (words[i] == COMMAND_READ_TRACKING_MODE)
+                read = true;
+            fixture.send_ack(words[i], words[i] == COMMAND_READ_TRACKING_MODE ? mode : nullptr, words[i] == COMMAND_READ_TRACKING_MODE ? 2 : 0);
+        }
+    }
+    return read;
+}
+
+// Cached settings are stored per component id, sensors with the default name do not share their settings
+static void test_settings_cache_per_instance()
+{
+    testing::set_millis(1000);
+    CHECK(start_cached_hub("radar_a"));
+    CHECK(!start_cached_hub("radar_a"));
+    CHECK(start_cached_hub("radar_b"));
+}
+
+int main()
+{
+    test_sequences_are_atomic();
+    test_rejected_switch_reverts();
+    test_settings_cache_per_instance();
+    printf("command_queue_test: passed\n");
+    return 0;
+}
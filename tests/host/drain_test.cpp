@@ -0,0 +1,64 @@
+#include "hub_test.h"
+
+// A backlog containing data messages followed by a config acknowledgement must not lose the config mode, which is
+// entered by the acknowledgement and left by processing data messages.
+static void test_mixed_batch()
+{
+    testing::set_millis(1000);
+    HubFixture fixture;
+    fixture.hub.setup();
+
+    // The startup reads are sent within a config session, which starts with the enter config command
+    fixture.hub.loop();
+    uint8_t words[16];
+    CHECK_EQ(sent_commands(fixture.uart, words, 16), 1);
+    CHECK_EQ(words[0], COMMAND_ENTER_CONFIG);
+
+    // Two buffered data messages and the acknowledgement are drained within a single loop iteration
+    const Slot slots[3] = {{100, 1000, 0, 360}, {}, {}};
+    fixture.send_frame(slots);
+    fixture.send_frame(slots);
+    fixture.send_ack(COMMAND_ENTER_CONFIG);
+    fixture.hub.loop();
+    CHECK(fixture.occupancy.state);
+    CHECK_EQ(fixture.hub.get_snapshot().target_count, 1);
+
+    // The hub is in config mode and continues with the first queued read instead of entering config mode again
+    fixture.uart.tx.clear();
+    testing::advance(COMMAND_RETRY_DELAY + 1);
+    fixture.hub.loop();
+    CHECK_EQ(sent_commands(fixture.uart, words, 16), 1);
+    CHECK_EQ(words[0], COMMAND_READ_TRACKING_MODE);
+}
+
+// A config acknowledgement between data messages is applied in stream order.
+static void test_ack_between_data()
+{
+    testing::set_millis(1000);
+    HubFixture fixture;
+    fixture.hub.setup();
+    fixture.hub.loop();
+
+    const Slot slots[3] = {{100, 1000, 0, 360}, {}, {}};
+    fixture.send_frame(slots);
+    fixture.send_ack(COMMAND_ENTER_CONFIG);
+    fixture.send_empty_frame();
+    fixture.hub.loop();
+
+    // The newest data message is processed last, it left the config mode and cleared the target
+    CHECK(!fixture.occupancy.state);
+    fixture.uart.tx.clear();
+    testing::advance(COMMAND_RETRY_DELAY + 1);
+    fixture.hub.loop();
+    uint8_t words[16];
+    CHECK_EQ(sent_commands(fixture.uart, words, 16), 1);
+    CHECK_EQ(words[0], COMMAND_ENTER_CONFIG);
+}
+
+int main()
+{
+    test_mixed_batch();
+    test_ack_between_data();
+    printf("drain_test: passed\n");
+    return 0;
+}
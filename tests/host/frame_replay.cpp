@@ -0,0 +1,55 @@
+#include <cstdio>
+#include "hub_test.h"
+
+/**
+ * Replays a binary file of data frames (e.g. written by tools/generate_frames.py) through the UART of the hub and prints
+ * the targets of each processed frame, one line per frame: "x y speed resolution" per slot, "-" for empty slots.
+ * The output is compared against the reference decoder of the generator by check_generated_frames.py.
+ */
+int main(int argc, char **argv)
+{
+    if (argc != 2)
+    {
+        fprintf(stderr, "Usage: %s frames.bin\n", argv[0]);
+        return 2;
+    }
+    FILE *file = fopen(argv[1], "rb");
+    if (file == nullptr)
+    {
+        perror(argv[1]);
+        return 2;
+    }
+
+    testing::set_millis(1000);
+    HubFixture fixture;
+    fixture.hub.set_fast_startup(true);
+    fixture.hub.setup();
+
+    uint8_t buffer[DATA_FRAME_SIZE];
+    uint32_t sequence = 0;
+    while (fread(buffer, 1, sizeof(buffer), file) == sizeof(buffer))
+    {
+        // Frames of the default rate of 10 Hz
+        fixture.uart.receive(buffer, sizeof(buffer));
+        fixture.run(100);
+
+        FrameSnapshot snapshot = fixture.hub.get_snapshot();
+        if (snapshot.sequence == sequence)
+        {
+            fprintf(stderr, "Frame %u was not processed.\n", unsigned(sequence));
+            return 1;
+        }
+        sequence = snapshot.sequence;
+        for (int i = 0; i < 3; i++)
+        {
+            const TargetSnapshot &target = snapshot.targets[i];
+            if (target.present)
+                printf("%s%i %i %i %i", i > 0 ? "; " : "", target.x, target.y, target.speed, target.resolution);
+            else
+                printf("%s-", i > 0 ? "; " : "");
+        }
+        printf("\n");
+    }
+    fclose(file);
+    return 0;
+}
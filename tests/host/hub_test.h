@@ -0,0 +1,70 @@
+#pragma once
+#include "LD2450.h"
+#include "sensor_frames.h"
+#include "test.h"
+
+using namespace esphome;
+using namespace esphome::ld2450;
+
+/**
+ * Hub connected to a fake UART, time is advanced explicitly by the test.
+ */
+struct HubFixture
+{
+    HubFixture()
+    {
+        hub.set_uart_parent(&uart);
+        hub.set_occupancy_binary_sensor(&occupancy);
+    }
+
+    void send_frame(const Slot slots[3])
+    {
+        uint8_t buffer[DATA_FRAME_SIZE];
+        uart.receive(buffer, encode_data_frame(buffer, slots));
+    }
+
+    void send_empty_frame()
+    {
+        const Slot slots[3] = {};
+        send_frame(slots);
+    }
+
+    void send_ack(uint8_t command, const uint8_t *data = nullptr, size_t length = 0)
+    {
+        uint8_t buffer[ACK_FRAME_MAX_SIZE];
+        uart.receive(buffer, encode_ack(buffer, command, data, length));
+    }
+
+    /// @brief Runs the loop for the given time in steps of 1 ms
+    void run(uint32_t duration)
+    {
+        for (uint32_t i = 0; i < duration; i++)
+        {
+            hub.loop();
+            testing::advance(1);
+        }
+    }
+
+    uart::UARTComponent uart;
+    binary_sensor::BinarySensor occupancy;
+    LD2450 hub;
+};
+
+/**
+ * Extracts the command words of all config commands written by the hub, in order.
+ * @return number of commands stored in words
+ */
+static inline size_t sent_commands(const uart::UARTComponent &uart, uint8_t *words, size_t max_words)
+{
+    size_t count = 0;
+    const std::vector<uint8_t> &tx = uart.tx;
+    for (size_t i = 0; i + 6 < tx.size() && count < max_words; i++)
+    {
+        if (tx[i] == 0xFD && tx[i + 1] == 0xFC && tx[i + 2] == 0xFB && tx[i + 3] == 0xFA)
+        {
+            words[count++] = tx[i + 6];
+            i += 6 + (tx[i + 4] | tx[i + 5] << 8) + 3;
+        }
+    }
+    return count;
+}
@@ -0,0 +1,93 @@
+#include <cmath>
+#include "grid.h"
+#include "test.h"
+#include "tracker.h"
+#include "trajectory.h"
+
+using namespace esphome::ld2450;
+
+// Grid placement relative to the sensor or within room coordinates
+static void test_grid_origin()
+{
+    Grid grid;
+    grid.set_dimensions(6, 4, 0.5f);
+    CHECK_EQ(grid.get_x_min(), -3000);
+    CHECK_EQ(grid.get_y_min(), 0);
+    CHECK_EQ(grid.cell_index(-3000, 0), 0);
+    CHECK_EQ(grid.cell_index(2999, 3999), grid.size() - 1);
+    CHECK_EQ(grid.cell_index(0, -1), -1);
+
+    // Room of 6 x 4 m with the sensor mounted at (4 m, 1 m)
+    grid.set_origin(0, -1);
+    CHECK_EQ(grid.get_x_min(), 0);
+    CHECK_EQ(grid.get_y_min(), -1000);
+    CHECK_EQ(grid.cell_index(-1, 0), -1);
+    CHECK_EQ(grid.cell_index(0, -1000), 0);
+    CHECK_EQ(grid.cell_index(5999, 2999), grid.size() - 1);
+    CHECK_EQ(grid.cell_index(6000, 0), -1);
+    Point center = grid.cell_center(grid.cell_index(4100, 1200));
+    CHECK_EQ(center.x, 4250);
+    CHECK_EQ(center.y, 1250);
+}
+
+// The radial speed is directed away from the sensor, not from the origin of the room
+static void test_tracker_seed()
+{
+    AlphaBetaTracker tracker;
+    tracker.seed(0, 1000, 100, 0);
+    int16_t x, y;
+    tracker.predict(1000, x, y);
+    CHECK_EQ(x, 0);
+    CHECK_EQ(y, 2000);
+
+    // Sensor at (2 m, 0 m), target straight ahead moving away with 1 m/s
+    tracker.set_origin(2000, 0);
+    tracker.seed(2000, 1000, 100, 0);
+    tracker.predict(1000, x, y);
+    CHECK_EQ(x, 2000);
+    CHECK_EQ(y, 2000);
+
+    // Target approaching the sensor diagonally
+    tracker.seed(5000, 4000, -500, 0);
+    tracker.predict(1000, x, y);
+    CHECK_EQ(x, 2000);
+    CHECK_EQ(y, 0);
+}
+
+// Radial velocity and heading relate to the posed sensor, not to the origin of the room
+static void test_trajectory_pose()
+{
+    // Sensor at (3 m, 1 m) facing along the y-axis, target walks from (0 m, 2 m) to (1 m, 2 m) towards it
+    Trajectory trajectory;
+    trajectory.set_sensor_pose({3000, 1000, 1, 0});
+    for (int i = 0; i <= 10; i++)
+        trajectory.add(i * 100, 2000, i * 100);
+    // Relative to the origin of the room, the target would move away
+    float radial_velocity = trajectory.get_radial_velocity();
+    CHECK(radial_velocity < -900);
+    CHECK(radial_velocity > -1000);
+    CHECK(fabsf(trajectory.get_heading(100) - 90) < 1);
+
+    // Sensor rotated by 90 degrees counter-clockwise faces along the negative x-axis, target walks away from it
+    trajectory.clear();
+    trajectory.set_sensor_pose({3000, 1000, 0, 1});
+    for (int i = 0; i <= 10; i++)
+        trajectory.add(2000 - i * 100, 1000, i * 100);
+    CHECK(trajectory.get_radial_velocity() > 900);
+    CHECK(fabsf(trajectory.get_heading(100)) < 1);
+
+    // Movement along the y-axis of the room is sideways towards the positive x-axis of the sensor
+    trajectory.clear();
+    for (int i = 0; i <= 10; i++)
+        trajectory.add(2000, 1000 + i * 100, i * 100);
+    CHECK(fabsf(trajectory.get_heading(100) - 90) < 1);
+}
+
+int main()
+{
+    test_grid_origin();
+    test_tracker_seed();
+    test_trajectory_pose();
+    printf("pose_test: passed\n");
+    return 0;
+}
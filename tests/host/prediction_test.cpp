@@ -0,0 +1,81 @@
+#include "hub_test.h"
+
+// Extrapolations beyond the coordinate range saturate instead of wrapping around
+static void test_prediction_is_clamped()
+{
+    AlphaBetaTracker tracker;
+    tracker.seed(30000, 30000, 1000, 0);
+    int16_t x, y;
+    tracker.predict(60000, x, y);
+    CHECK_EQ(x, INT16_MAX);
+    CHECK_EQ(y, INT16_MAX);
+
+    tracker.seed(-30000, 100, -1000, 0);
+    tracker.predict(60000, x, y);
+    CHECK_EQ(x, INT16_MAX);
+    tracker.seed(-30000, 100, 1000, 0);
+    tracker.predict(60000, x, y);
+    CHECK_EQ(x, INT16_MIN);
+}
+
+// Coasting targets are reported as predicted, not as detected, and leave zones along their predicted path
+static void test_coasting_target_is_predicted()
+{
+    testing::set_millis(1000);
+    HubFixture fixture;
+    Zone zone;
+    ZoneTrigger enter_trigger, exit_trigger;
+    zone.set_name("Zone");
+    zone.set_circle(0.0f, 2.0f, 0.5f);
+    zone.add_on_enter_trigger(&enter_trigger);
+    zone.add_on_exit_trigger(&exit_trigger);
+    fixture.hub.register_zone(&zone);
+    fixture.hub.set_prediction(0.8f, 0.3f, 2, 0);
+    fixture.hub.set_fast_startup(true);
+    fixture.hub.setup();
+
+    // Target crosses the zone along the x-axis with 2 m/s
+    for (int16_t x = -400; x <= 600; x += 200)
+    {
+        const Slot slots[3] = {{x, 2000, 0, 360}, {}, {}};
+        fixture.send_frame(slots);
+        fixture.run(100);
+    }
+    CHECK_EQ(enter_trigger.triggered, 1);
+    CHECK(zone.is_tracking(0));
+
+    // First missing measurement is bridged, the predicted position is still within the margin of the zone
+    fixture.send_empty_frame();
+    fixture.run(100);
+    FrameSnapshot snapshot = fixture.hub.get_snapshot();
+    CHECK(!snapshot.targets[0].present);
+    CHECK(snapshot.targets[0].predicted);
+    CHECK_EQ(snapshot.targets[0].resolution, 0);
+    CHECK(snapshot.targets[0].x > 600);
+    CHECK_EQ(snapshot.target_count, 1);
+    CHECK(fixture.occupancy.state);
+
+    // The predicted position leaves the margin, the target exits without waiting for the target timeout
+    fixture.send_empty_frame();
+    fixture.run(100);
+    snapshot = fixture.hub.get_snapshot();
+    CHECK(snapshot.targets[0].predicted);
+    CHECK_EQ(exit_trigger.triggered, 1);
+    CHECK(!zone.is_tracking(0));
+
+    // Coasting ends after max_coast_frames
+    fixture.send_empty_frame();
+    fixture.run(100);
+    snapshot = fixture.hub.get_snapshot();
+    CHECK(!snapshot.targets[0].present && !snapshot.targets[0].predicted);
+    CHECK_EQ(snapshot.target_count, 0);
+    CHECK(!fixture.occupancy.state);
+}
+
+int main()
+{
+    test_prediction_is_clamped();
+    test_coasting_target_is_predicted();
+    printf("prediction_test: passed\n");
+    return 0;
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Encoders for messages of the LD2450 sensor, mirroring tools/generate_frames.py and tools/emulate_sensor.py.
+#define DATA_FRAME_SIZE 30
+#define ACK_FRAME_MAX_SIZE 40
+
+struct Slot
+{
+    int16_t x;
+    int16_t y;
+    int16_t speed;
+    uint16_t resolution;
+};
+
+static inline uint16_t encode_signed(int16_t value)
+{
+    return value >= 0 ? value : 0x8000 - value;
+}
+
+static inline void put_u16(uint8_t *out, uint16_t value)
+{
+    out[0] = value & 0xFF;
+    out[1] = value >> 8;
+}
+
+/**
+ * Encodes a data message with three target slots, slots with resolution 0 are empty.
+ * @return number of bytes written (DATA_FRAME_SIZE)
+ */
+static inline size_t encode_data_frame(uint8_t *out, const Slot slots[3])
+{
+    static const uint8_t header[4] = {0xAA, 0xFF, 0x03, 0x00};
+    memcpy(out, header, 4);
+    for (int i = 0; i < 3; i++)
+    {
+        uint8_t *slot = out + 4 + 8 * i;
+        if (slots[i].resolution == 0)
+        {
+            memset(slot, 0, 8);
+            continue;
+        }
+        put_u16(slot + 0, encode_signed(slots[i].x));
+        put_u16(slot + 2, slots[i].y + 0x8000);
+        put_u16(slot + 4, encode_signed(slots[i].speed));
+        put_u16(slot + 6, slots[i].resolution);
+    }
+    out[28] = 0x55;
+    out[29] = 0xCC;
+    return DATA_FRAME_SIZE;
+}
+
+/**
+ * Encodes the acknowledgement of a config command.
+ * @return number of bytes written
+ */
+static inline size_t encode_ack(uint8_t *out, uint8_t command, const uint8_t *data = nullptr, size_t length = 0)
+{
+    static const uint8_t header[4] = {0xFD, 0xFC, 0xFB, 0xFA};
+    static const uint8_t end[4] = {0x04, 0x03, 0x02, 0x01};
+    memcpy(out, header, 4);
+    put_u16(out + 4, 4 + length);
+    const uint8_t content[4] = {command, 0x01, 0x00, 0x00};
+    memcpy(out + 6, content, 4);
+    if (length > 0)
+        memcpy(out + 10, data, length);
+    memcpy(out + 10 + length, end, 4);
+    return 14 + length;
+}
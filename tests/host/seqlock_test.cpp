@@ -0,0 +1,68 @@
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include "seqlock.h"
+#include "test.h"
+
+using namespace esphome::ld2450;
+
+#define WRITES 1000000
+#define READERS 2
+
+// Every word is derived from the same counter, a torn copy mixes words of different writes
+struct Value
+{
+    uint32_t counter;
+    uint32_t words[15];
+    uint16_t tail;
+};
+
+static Value make_value(uint32_t counter)
+{
+    Value value{};
+    value.counter = counter;
+    for (uint32_t i = 0; i < 15; i++)
+        value.words[i] = counter * 31 + i;
+    value.tail = uint16_t(counter ^ 0xA5A5);
+    return value;
+}
+
+int main()
+{
+    static SeqLock<Value> lock;
+    static std::atomic<bool> done{false};
+    lock.write(make_value(0));
+
+    std::thread readers[READERS];
+    static uint32_t reads[READERS] = {0};
+    for (int r = 0; r < READERS; r++)
+    {
+        readers[r] = std::thread([r]()
+                                 {
+            uint32_t last = 0;
+            while (!done.load(std::memory_order_acquire))
+            {
+                Value value = lock.read();
+                Value expected = make_value(value.counter);
+                for (uint32_t i = 0; i < 15; i++)
+                    CHECK_EQ(value.words[i], expected.words[i]);
+                CHECK_EQ(value.tail, expected.tail);
+                // Values are never observed out of order by the same reader
+                CHECK(value.counter >= last);
+                last = value.counter;
+                reads[r]++;
+            } });
+    }
+
+    for (uint32_t i = 1; i <= WRITES; i++)
+        lock.write(make_value(i));
+    done.store(true, std::memory_order_release);
+    for (std::thread &reader : readers)
+        reader.join();
+
+    CHECK_EQ(lock.read().counter, WRITES);
+    for (int r = 0; r < READERS; r++)
+        CHECK(reads[r] > 0);
+    printf("seqlock_test: %u writes, %u reads passed\n", unsigned(WRITES), unsigned(reads[0] + reads[1]));
+    return 0;
+}
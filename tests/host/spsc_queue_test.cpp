@@ -0,0 +1,53 @@
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "spsc_queue.h"
+#include "test.h"
+
+using namespace esphome::ld2450;
+
+#define ITEMS 2000000
+
+struct Item
+{
+    uint32_t sequence;
+    uint32_t checksum;
+};
+
+int main()
+{
+    // Small capacity, such that head and tail wrap around many times
+    static SpscQueue<Item, 8> queue;
+    static std::vector<uint8_t> seen(ITEMS, 0);
+
+    std::thread producer([]()
+                         {
+        for (uint32_t i = 0; i < ITEMS; i++)
+        {
+            while (!queue.push({i, ~i}))
+                std::this_thread::yield();
+        } });
+
+    uint32_t expected = 0;
+    Item item;
+    while (expected < ITEMS)
+    {
+        if (!queue.pop(item))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        // Items arrive in order, without loss, duplicates or torn copies
+        CHECK_EQ(item.sequence, expected);
+        CHECK_EQ(item.checksum, ~expected);
+        CHECK_EQ(seen[item.sequence], 0);
+        seen[item.sequence] = 1;
+        expected++;
+    }
+    producer.join();
+
+    CHECK(queue.empty());
+    CHECK(!queue.pop(item));
+    printf("spsc_queue_test: %u items passed\n", unsigned(expected));
+    return 0;
+}
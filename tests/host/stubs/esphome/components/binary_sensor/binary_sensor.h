@@ -0,0 +1,34 @@
+#pragma once
+#include "esphome/core/component.h"
+
+namespace esphome::binary_sensor
+{
+    class BinarySensor : public EntityBase
+    {
+    public:
+        void publish_state(bool state)
+        {
+            this->state = state;
+            has_state_ = true;
+            publishes++;
+        }
+        void publish_initial_state(bool state) { publish_state(state); }
+        bool has_state() const { return has_state_; }
+
+        bool state = false;
+        int publishes = 0;
+
+    protected:
+        bool has_state_ = false;
+    };
+} // namespace esphome::binary_sensor
+
+#define SUB_BINARY_SENSOR(name)                                                   \
+protected:                                                                        \
+    binary_sensor::BinarySensor *name##_binary_sensor_{nullptr};                  \
+                                                                                  \
+public:                                                                           \
+    void set_##name##_binary_sensor(binary_sensor::BinarySensor *binary_sensor)   \
+    {                                                                             \
+        this->name##_binary_sensor_ = binary_sensor;                              \
+    }
@@ -0,0 +1,32 @@
+#pragma once
+#include <functional>
+#include "esphome/core/component.h"
+
+namespace esphome::button
+{
+    class Button : public EntityBase
+    {
+    public:
+        void press()
+        {
+            press_action();
+            if (callback_)
+                callback_();
+        }
+        void add_on_press_callback(std::function<void()> &&callback) { callback_ = std::move(callback); }
+
+    protected:
+        virtual void press_action() = 0;
+        std::function<void()> callback_;
+    };
+} // namespace esphome::button
+
+#define SUB_BUTTON(name)                                   \
+protected:                                                 \
+    button::Button *name##_button_{nullptr};               \
+                                                           \
+public:                                                    \
+    void set_##name##_button(button::Button *button)       \
+    {                                                      \
+        this->name##_button_ = button;                     \
+    }
@@ -0,0 +1,25 @@
+#pragma once
+#include "esphome/core/component.h"
+
+namespace esphome::number
+{
+    class Number : public EntityBase
+    {
+    public:
+        void publish_state(float state) { this->state = state; }
+        float state = 0;
+
+    protected:
+        virtual void control(float value) = 0;
+    };
+} // namespace esphome::number
+
+#define SUB_NUMBER(name)                                   \
+protected:                                                 \
+    number::Number *name##_number_{nullptr};               \
+                                                           \
+public:                                                    \
+    void set_##name##_number(number::Number *number)       \
+    {                                                      \
+        this->name##_number_ = number;                     \
+    }
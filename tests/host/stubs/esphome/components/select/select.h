@@ -0,0 +1,21 @@
+#pragma once
+#include <string>
+#include "esphome/core/component.h"
+
+namespace esphome::select
+{
+    class Select : public EntityBase
+    {
+    public:
+        void publish_state(const std::string &state)
+        {
+            this->state = state;
+            publish_count++;
+        }
+        std::string state;
+        int publish_count = 0;
+
+    protected:
+        virtual void control(const std::string &value) = 0;
+    };
+} // namespace esphome::select
@@ -0,0 +1,37 @@
+#pragma once
+#include <cmath>
+#include "esphome/core/component.h"
+
+namespace esphome::sensor
+{
+    class Sensor : public EntityBase
+    {
+    public:
+        void publish_state(float state)
+        {
+            this->raw_state = state;
+            this->state = state;
+            has_state_ = true;
+            publishes++;
+        }
+        bool has_state() const { return has_state_; }
+        void set_unit_of_measurement(const char *unit) { unit_of_measurement_ = unit; }
+
+        float state = NAN;
+        float raw_state = NAN;
+        int publishes = 0;
+
+    protected:
+        bool has_state_ = false;
+    };
+} // namespace esphome::sensor
+
+#define SUB_SENSOR(name)                                   \
+protected:                                                 \
+    sensor::Sensor *name##_sensor_{nullptr};               \
+                                                           \
+public:                                                    \
+    void set_##name##_sensor(sensor::Sensor *sensor)       \
+    {                                                      \
+        this->name##_sensor_ = sensor;                     \
+    }
@@ -0,0 +1,20 @@
+#pragma once
+#include "esphome/core/component.h"
+
+namespace esphome::switch_
+{
+    class Switch : public EntityBase
+    {
+    public:
+        void publish_state(bool state)
+        {
+            this->state = state;
+            publish_count++;
+        }
+        bool state = false;
+        int publish_count = 0;
+
+    protected:
+        virtual void write_state(bool state) = 0;
+    };
+} // namespace esphome::switch_
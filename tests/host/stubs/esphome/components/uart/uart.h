@@ -0,0 +1,109 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "esphome/core/component.h"
+
+namespace esphome::uart
+{
+    // Fake UART bus: received bytes are queued by the test, written bytes are captured. Both buffers have a fixed
+    // capacity, such that reading and writing does not allocate.
+    class UARTComponent
+    {
+    public:
+        UARTComponent()
+        {
+            rx_.resize(RX_CAPACITY);
+            tx.reserve(TX_CAPACITY);
+        }
+
+        void set_baud_rate(uint32_t baud_rate) { baud_rate_ = baud_rate; }
+        uint32_t get_baud_rate() const { return baud_rate_; }
+        void load_settings(bool dump_config) { settings_loaded++; }
+        void load_settings() { settings_loaded++; }
+
+        /// @brief Queues received bytes, excess bytes are dropped like on an overflowing rx buffer
+        void receive(const uint8_t *data, size_t length)
+        {
+            for (size_t i = 0; i < length && rx_count_ < RX_CAPACITY; i++, rx_count_++)
+                rx_[(rx_head_ + rx_count_) % RX_CAPACITY] = data[i];
+        }
+        void receive(const std::vector<uint8_t> &data) { receive(data.data(), data.size()); }
+
+        int available() const { return rx_count_; }
+        bool read_byte(uint8_t *data)
+        {
+            if (rx_count_ == 0)
+                return false;
+            *data = rx_[rx_head_];
+            rx_head_ = (rx_head_ + 1) % RX_CAPACITY;
+            rx_count_--;
+            return true;
+        }
+        bool peek_byte(uint8_t *data)
+        {
+            if (rx_count_ == 0)
+                return false;
+            *data = rx_[rx_head_];
+            return true;
+        }
+        void write(const uint8_t *data, size_t length)
+        {
+            for (size_t i = 0; i < length && tx.size() < TX_CAPACITY; i++)
+                tx.push_back(data[i]);
+        }
+
+        static const size_t RX_CAPACITY = 1 << 16;
+        static const size_t TX_CAPACITY = 1 << 16;
+
+        /// @brief Bytes written by the device
+        std::vector<uint8_t> tx;
+
+        /// @brief Number of load_settings() calls
+        int settings_loaded = 0;
+
+    protected:
+        uint32_t baud_rate_ = 256000;
+        std::vector<uint8_t> rx_;
+        size_t rx_head_ = 0;
+        size_t rx_count_ = 0;
+    };
+
+    class UARTDevice
+    {
+    public:
+        UARTDevice() = default;
+        UARTDevice(UARTComponent *parent) : parent_(parent) {}
+        void set_uart_parent(UARTComponent *parent) { parent_ = parent; }
+
+        void write_byte(uint8_t data) { parent_->write(&data, 1); }
+        void write_array(const uint8_t *data, size_t length) { parent_->write(data, length); }
+        void write_array(const std::vector<uint8_t> &data) { parent_->write(data.data(), data.size()); }
+        void write(uint8_t data) { write_byte(data); }
+        bool read_byte(uint8_t *data) { return parent_->read_byte(data); }
+        bool peek_byte(uint8_t *data) { return parent_->peek_byte(data); }
+        bool read_array(uint8_t *data, size_t length)
+        {
+            if (parent_->available() < int(length))
+                return false;
+            for (size_t i = 0; i < length; i++)
+                parent_->read_byte(&data[i]);
+            return true;
+        }
+        int available() { return parent_->available(); }
+        void flush() {}
+        int read()
+        {
+            uint8_t data = 0;
+            return read_byte(&data) ? data : -1;
+        }
+        int peek()
+        {
+            uint8_t data = 0;
+            return peek_byte(&data) ? data : -1;
+        }
+
+    protected:
+        UARTComponent *parent_{nullptr};
+    };
+} // namespace esphome::uart
@@ -0,0 +1,53 @@
+#pragma once
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace esphome
+{
+    template <typename T, typename... X>
+    class TemplatableValue
+    {
+    public:
+        TemplatableValue() {}
+        TemplatableValue(T value) : value_(value), has_value_(true) {}
+        T value(X... x) { return value_; }
+        bool has_value() const { return has_value_; }
+
+    protected:
+        T value_{};
+        bool has_value_{false};
+    };
+
+#define TEMPLATABLE_VALUE_(type, name)                \
+protected:                                            \
+    TemplatableValue<type, Ts...> name##_{};          \
+                                                      \
+public:                                               \
+    template <typename V>                             \
+    void set_##name(V name) { this->name##_ = name; }
+#define TEMPLATABLE_VALUE(type, name) TEMPLATABLE_VALUE_(type, name)
+
+    // Triggers count their invocations and keep the arguments of the last one
+    template <typename... Ts>
+    class Trigger
+    {
+    public:
+        void trigger(Ts... x) { triggered++; }
+        int triggered = 0;
+    };
+
+    template <typename... Ts>
+    class Action
+    {
+    public:
+        virtual void play(const Ts &...x) = 0;
+    };
+
+    template <typename... Ts>
+    class Condition
+    {
+    public:
+        virtual bool check(const Ts &...x) = 0;
+    };
+} // namespace esphome
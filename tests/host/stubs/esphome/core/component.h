@@ -0,0 +1,54 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <string>
+#include "esphome/core/automation.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+namespace esphome
+{
+    namespace setup_priority
+    {
+        extern const float DATA;
+        extern const float LATE;
+        extern const float PROCESSOR;
+    } // namespace setup_priority
+
+    class Component
+    {
+    public:
+        virtual void setup() {}
+        virtual void loop() {}
+        virtual void dump_config() {}
+        virtual void on_shutdown() {}
+        virtual float get_setup_priority() const { return 0; }
+    };
+
+    class PollingComponent : public Component
+    {
+    public:
+        PollingComponent() {}
+        explicit PollingComponent(uint32_t interval) : update_interval_(interval) {}
+        virtual void update() = 0;
+        virtual void set_update_interval(uint32_t interval) { update_interval_ = interval; }
+        virtual uint32_t get_update_interval() const { return update_interval_; }
+
+    protected:
+        uint32_t update_interval_ = 0;
+    };
+
+    class EntityBase
+    {
+    public:
+        const char *get_name() const { return name_; }
+        void set_name(const char *name) { name_ = name; }
+        uint32_t get_object_id_hash() { return fnv1_hash(name_); }
+        bool is_internal() const { return false; }
+
+    protected:
+        const char *name_ = "";
+        const char *unit_of_measurement_{nullptr};
+    };
+} // namespace esphome
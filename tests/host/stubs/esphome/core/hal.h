@@ -0,0 +1,17 @@
+#pragma once
+#include <cstdint>
+
+// Host replacement of the ESPHome HAL, time only advances when a test calls testing::advance()
+namespace esphome
+{
+    uint32_t millis();
+    uint32_t micros();
+    void delay(uint32_t ms);
+    void yield();
+
+    namespace testing
+    {
+        void set_millis(uint32_t ms);
+        void advance(uint32_t ms);
+    } // namespace testing
+} // namespace esphome
@@ -0,0 +1,27 @@
+#pragma once
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace esphome
+{
+    template <typename T>
+    class Parented
+    {
+    public:
+        Parented() {}
+        Parented(T *parent) : parent_(parent) {}
+        void set_parent(T *parent) { parent_ = parent; }
+        T *get_parent() const { return parent_; }
+
+    protected:
+        T *parent_{nullptr};
+    };
+
+    uint32_t fnv1_hash(const std::string &str);
+} // namespace esphome
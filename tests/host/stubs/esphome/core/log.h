@@ -0,0 +1,38 @@
+#pragma once
+#include <cstdarg>
+
+// Host replacement of the ESPHome logger. Messages are formatted into a static buffer (no allocations) and are only
+// printed if the environment variable HOST_TEST_VERBOSE is set.
+#define ESPHOME_LOG_LEVEL_ERROR 1
+#define ESPHOME_LOG_LEVEL_WARN 2
+#define ESPHOME_LOG_LEVEL_INFO 3
+#define ESPHOME_LOG_LEVEL_CONFIG 4
+#define ESPHOME_LOG_LEVEL_DEBUG 5
+#define ESPHOME_LOG_LEVEL_VERBOSE 6
+#define ESPHOME_LOG_LEVEL_VERY_VERBOSE 7
+
+#define ESP_LOGE(tag, ...) ::esphome::testing::log(ESPHOME_LOG_LEVEL_ERROR, tag, __VA_ARGS__)
+#define ESP_LOGW(tag, ...) ::esphome::testing::log(ESPHOME_LOG_LEVEL_WARN, tag, __VA_ARGS__)
+#define ESP_LOGI(tag, ...) ::esphome::testing::log(ESPHOME_LOG_LEVEL_INFO, tag, __VA_ARGS__)
+#define ESP_LOGCONFIG(tag, ...) ::esphome::testing::log(ESPHOME_LOG_LEVEL_CONFIG, tag, __VA_ARGS__)
+#define ESP_LOGD(tag, ...) ::esphome::testing::log(ESPHOME_LOG_LEVEL_DEBUG, tag, __VA_ARGS__)
+#define ESP_LOGV(tag, ...) ::esphome::testing::log(ESPHOME_LOG_LEVEL_VERBOSE, tag, __VA_ARGS__)
+#define ESP_LOGVV(tag, ...) ::esphome::testing::log(ESPHOME_LOG_LEVEL_VERY_VERBOSE, tag, __VA_ARGS__)
+
+#define LOG_SENSOR(prefix, type, obj) (void)(obj)
+#define LOG_BINARY_SENSOR(prefix, type, obj) (void)(obj)
+#define LOG_NUMBER(prefix, type, obj) (void)(obj)
+#define LOG_BUTTON(prefix, type, obj) (void)(obj)
+#define LOG_SWITCH(prefix, type, obj) (void)(obj)
+#define LOG_SELECT(prefix, type, obj) (void)(obj)
+
+namespace esphome::testing
+{
+    void log(int level, const char *tag, const char *format, ...) __attribute__((format(printf, 3, 4)));
+
+    /// @brief Last message logged with at least warning severity, empty if none
+    const char *last_warning();
+
+    /// @brief Forgets the last warning
+    void clear_warning();
+} // namespace esphome::testing
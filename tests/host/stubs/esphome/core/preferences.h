@@ -0,0 +1,61 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <vector>
+
+namespace esphome
+{
+    // In-memory preferences, stored values survive until testing::clear_preferences() is called
+    class ESPPreferenceObject
+    {
+    public:
+        ESPPreferenceObject() {}
+        ESPPreferenceObject(std::vector<uint8_t> *data) : data_(data) {}
+
+        template <typename T>
+        bool save(const T *src)
+        {
+            if (data_ == nullptr)
+                return false;
+            data_->assign(reinterpret_cast<const uint8_t *>(src), reinterpret_cast<const uint8_t *>(src) + sizeof(T));
+            return true;
+        }
+
+        template <typename T>
+        bool load(T *dest)
+        {
+            if (data_ == nullptr || data_->size() != sizeof(T))
+                return false;
+            memcpy(dest, data_->data(), sizeof(T));
+            return true;
+        }
+
+    protected:
+        std::vector<uint8_t> *data_{nullptr};
+    };
+
+    class ESPPreferences
+    {
+    public:
+        template <typename T>
+        ESPPreferenceObject make_preference(uint32_t type, bool in_flash)
+        {
+            return make_preference<T>(type);
+        }
+
+        template <typename T>
+        ESPPreferenceObject make_preference(uint32_t type)
+        {
+            std::vector<uint8_t> &data = storage[type];
+            data.reserve(sizeof(T));
+            return ESPPreferenceObject(&data);
+        }
+
+        bool sync() { return true; }
+
+        std::map<uint32_t, std::vector<uint8_t>> storage;
+    };
+
+    extern ESPPreferences *global_preferences;
+} // namespace esphome
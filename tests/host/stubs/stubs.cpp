@@ -0,0 +1,59 @@
+#include <cstdio>
+#include <cstdlib>
+#include "esphome/core/component.h"
+#include "esphome/core/preferences.h"
+
+namespace esphome
+{
+    namespace setup_priority
+    {
+        const float DATA = 600.0f;
+        const float LATE = -100.0f;
+        const float PROCESSOR = 400.0f;
+    } // namespace setup_priority
+
+    static uint64_t clock_us = 0;
+
+    uint32_t millis() { return uint32_t(clock_us / 1000); }
+    uint32_t micros() { return uint32_t(clock_us); }
+    void delay(uint32_t ms) { clock_us += uint64_t(ms) * 1000; }
+    void yield() {}
+
+    uint32_t fnv1_hash(const std::string &str)
+    {
+        uint32_t hash = 2166136261UL;
+        for (char c : str)
+        {
+            hash *= 16777619UL;
+            hash ^= uint8_t(c);
+        }
+        return hash;
+    }
+
+    static ESPPreferences preferences;
+    ESPPreferences *global_preferences = &preferences;
+
+    namespace testing
+    {
+        void set_millis(uint32_t ms) { clock_us = uint64_t(ms) * 1000; }
+        void advance(uint32_t ms) { clock_us += uint64_t(ms) * 1000; }
+
+        static char warning[256] = "";
+
+        void log(int level, const char *tag, const char *format, ...)
+        {
+            static char message[256];
+            va_list args;
+            va_start(args, format);
+            vsnprintf(message, sizeof(message), format, args);
+            va_end(args);
+            if (level <= ESPHOME_LOG_LEVEL_WARN)
+                snprintf(warning, sizeof(warning), "%s", message);
+            if (getenv("HOST_TEST_VERBOSE") != nullptr)
+                printf("[%s] %s\n", tag, message);
+        }
+
+        const char *last_warning() { return warning; }
+        void clear_warning() { warning[0] = '\0'; }
+    } // namespace testing
+} // namespace esphome
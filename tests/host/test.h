@@ -0,0 +1,26 @@
+#pragma once
+#include <cstdio>
+#include <cstdlib>
+
+// Minimal assertion helpers for the host tests, a failed check terminates the test binary with a non-zero exit code.
+#define CHECK(condition)                                                          \
+    do                                                                            \
+    {                                                                             \
+        if (!(condition))                                                         \
+        {                                                                         \
+            fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #condition); \
+            exit(1);                                                              \
+        }                                                                         \
+    } while (0)
+
+#define CHECK_EQ(actual, expected)                                                                                                       \
+    do                                                                                                                                   \
+    {                                                                                                                                    \
+        long long actual_value = (long long)(actual);                                                                                    \
+        long long expected_value = (long long)(expected);                                                                                \
+        if (actual_value != expected_value)                                                                                              \
+        {                                                                                                                                \
+            fprintf(stderr, "%s:%d: CHECK_EQ failed: %s == %lld, expected %lld\n", __FILE__, __LINE__, #actual, actual_value, expected_value); \
+            exit(1);                                                                                                                     \
+        }                                                                                                                                \
+    } while (0)
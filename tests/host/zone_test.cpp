@@ -0,0 +1,207 @@
+#include <cstring>
+#include "hub_test.h"
+
+// Targets which are tracked when the sensor stops sending updates leave the zone
+static void test_exit_on_sensor_loss()
+{
+    testing::set_millis(1000);
+    HubFixture fixture;
+    Zone zone;
+    ZoneTrigger enter_trigger, exit_trigger;
+    zone.set_name("Zone");
+    zone.set_circle(0.0f, 2.0f, 1.0f);
+    zone.add_on_enter_trigger(&enter_trigger);
+    zone.add_on_exit_trigger(&exit_trigger);
+    fixture.hub.register_zone(&zone);
+    fixture.hub.set_fast_startup(true);
+    fixture.hub.setup();
+
+    const Slot slots[3] = {{0, 2000, 0, 360}, {200, 1800, 0, 360}, {}};
+    for (int i = 0; i < 5; i++)
+    {
+        fixture.send_frame(slots);
+        fixture.run(100);
+    }
+    CHECK_EQ(enter_trigger.triggered, 2);
+    CHECK(zone.is_tracking(0) && zone.is_tracking(1));
+
+    // No more messages from the sensor
+    fixture.run(SENSOR_UNAVAILABLE_TIMEOUT + 100);
+    CHECK(!fixture.hub.is_sensor_available());
+    CHECK_EQ(exit_trigger.triggered, 2);
+    CHECK(!zone.is_tracking(0) && !zone.is_tracking(1));
+
+    // Targets enter again once the sensor is back
+    for (int i = 0; i < 2; i++)
+    {
+        fixture.send_frame(slots);
+        fixture.run(100);
+    }
+    CHECK_EQ(enter_trigger.triggered, 4);
+}
+
+// The dwell time keeps counting beyond 49.7 days, at which a ms counter would wrap
+static void test_dwell_time_overflow()
+{
+    testing::set_millis(0);
+    Zone zone;
+    sensor::Sensor dwell_time;
+    zone.set_name("Zone");
+    zone.set_circle(0.0f, 2.0f, 1.0f);
+    zone.set_dwell_time_sensor(&dwell_time);
+
+    Target target;
+    std::vector<Target *> targets{&target};
+    target.update_values(0, 2000, 0, 360, 0);
+
+    // 51 days in steps of 1 minute and 250 ms
+    const uint32_t step = 60250;
+    const uint32_t steps = 51 * 24 * 60;
+    uint32_t timestamp = 0;
+    zone.update(targets, true, timestamp);
+    for (uint32_t i = 0; i < steps; i++)
+    {
+        timestamp += step;
+        testing::set_millis(timestamp);
+        target.update_values(0, 2000, 0, 360, 0);
+        zone.update(targets, true, timestamp);
+    }
+    zone.publish_statistics();
+    CHECK_EQ(dwell_time.state, uint64_t(step) * steps / 1000);
+    CHECK_EQ(zone.get_dwell_time(), uint64_t(step) * steps / 1000);
+}
+
+// Persisted polygons only contain points within the int16_t range and are only restored into polygon zones
+static void test_polygon_persistence()
+{
+    testing::set_millis(0);
+    Zone stored;
+    stored.set_name("Persisted");
+    stored.set_restore_polygon(true);
+    stored.setup();
+
+    testing::clear_warning();
+    CHECK(!stored.store_polygon({Point(0, 0), Point(40000, 0), Point(0, 2000)}));
+    CHECK(strstr(testing::last_warning(), "out of range") != nullptr);
+    CHECK(stored.store_polygon({Point(2000, 2000), Point(3000, 2000), Point(3000, 3000), Point(2000, 3000)}));
+
+    // A circle zone with the same key keeps its shape
+    testing::clear_warning();
+    Zone circle;
+    circle.set_name("Persisted");
+    circle.set_circle(0.0f, 2.0f, 0.5f);
+    circle.set_restore_polygon(true);
+    circle.setup();
+    CHECK(strstr(testing::last_warning(), "only be restored into polygon zones") != nullptr);
+
+    Target target;
+    std::vector<Target *> targets{&target};
+    target.update_values(0, 2000, 0, 360, 0);
+    circle.update(targets, true, 0);
+    CHECK(circle.is_tracking(0));
+
+    // A polygon zone restores the persisted polygon
+    Zone polygon;
+    polygon.set_name("Persisted");
+    polygon.update_polygon({Point(-500, 1500), Point(500, 1500), Point(500, 2500), Point(-500, 2500)});
+    polygon.set_restore_polygon(true);
+    polygon.setup();
+    polygon.update(targets, true, 0);
+    CHECK(!polygon.is_tracking(0));
+    target.update_values(2500, 2500, 0, 360, 100);
+    polygon.update(targets, true, 100);
+    CHECK(polygon.is_tracking(0));
+}
+
+// Zones of several sensors may share their name, the persisted polygon is stored per zone id
+static void test_polygon_key_per_zone_id()
+{
+    testing::set_millis(0);
+    Zone stored;
+    stored.set_name("Kitchen");
+    stored.set_component_id("radar_a_kitchen");
+    stored.set_restore_polygon(true);
+    stored.setup();
+    CHECK(stored.store_polygon({Point(2000, 2000), Point(3000, 2000), Point(3000, 3000), Point(2000, 3000)}));
+
+    Zone other;
+    other.set_name("Kitchen");
+    other.set_component_id("radar_b_kitchen");
+    other.update_polygon({Point(-500, 1500), Point(500, 1500), Point(500, 2500), Point(-500, 2500)});
+    other.set_restore_polygon(true);
+    other.setup();
+    CHECK_EQ(other.get_polygon()[0].x, -500);
+
+    Zone restored;
+    restored.set_name("Kitchen");
+    restored.set_component_id("radar_a_kitchen");
+    restored.update_polygon({Point(-500, 1500), Point(500, 1500), Point(500, 2500), Point(-500, 2500)});
+    restored.set_restore_polygon(true);
+    restored.setup();
+    CHECK_EQ(restored.get_polygon()[0].x, 2000);
+}
+
+// Lines of several sensors may share their name, the persisted counts are stored per line id
+static void test_line_key_per_line_id()
+{
+    testing::set_millis(0);
+    CrossingLine stored;
+    stored.set_name("Door");
+    stored.set_component_id("radar_a_door");
+    stored.set_line(-1.0f, 2.0f, 1.0f, 2.0f);
+    stored.set_restore(true);
+    stored.setup();
+
+    // Target walks through the line towards the sensor
+    Target target;
+    target.update_values(0, 2500, 0, 360, 0);
+    target.update_values(0, 1500, 0, 360, 100);
+    stored.update(&target);
+    stored.save(true);
+    CHECK_EQ(stored.get_in_count() + stored.get_out_count(), 1);
+
+    CrossingLine other;
+    other.set_name("Door");
+    other.set_component_id("radar_b_door");
+    other.set_restore(true);
+    other.setup();
+    CHECK_EQ(other.get_in_count() + other.get_out_count(), 0);
+
+    CrossingLine restored;
+    restored.set_name("Door");
+    restored.set_component_id("radar_a_door");
+    restored.set_restore(true);
+    restored.setup();
+    CHECK_EQ(restored.get_in_count() + restored.get_out_count(), 1);
+}
+
+// Radii and distances beyond 46 m do not overflow the squared distances
+static void test_large_radius()
+{
+    testing::set_millis(0);
+    Zone zone;
+    zone.set_name("Large");
+    zone.set_circle(-20.0f, 0.0f, 50.0f);
+
+    Target target;
+    std::vector<Target *> targets{&target};
+    target.update_values(25000, 10000, 0, 360, 0);
+    zone.update(targets, true, 0);
+    CHECK(zone.is_tracking(0));
+
+    target.update_values(32000, 30000, 0, 360, 100);
+    zone.update(targets, true, 100);
+    CHECK(!zone.is_tracking(0));
+}
+
+int main()
+{
+    test_exit_on_sensor_loss();
+    test_dwell_time_overflow();
+    test_polygon_persistence();
+    test_polygon_key_per_zone_id();
+    test_line_key_per_line_id();
+    test_large_radius();
+    printf("zone_test: passed\n");
+    return 0;
+}
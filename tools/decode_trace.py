@@ -0,0 +1,93 @@
+"""Decode a target trace which was dumped by the LD2450.trace.dump action.
+
+Usage:
+    python3 tools/decode_trace.py device.log
+    esphome logs device.yaml | python3 tools/decode_trace.py
+    python3 tools/decode_trace.py device.log --csv trace.csv
+
+The last complete dump within the log is used. Records are printed oldest
+first, one line per traced measurement.
+"""
+
+import argparse
+import base64
+import csv
+import re
+import struct
+import sys
+
+HEADER = re.compile(r"TRACE (\d+) (\d+)\s*$")
+CHUNK = re.compile(r"TRACE ([0-9A-F]{4}) ([A-Za-z0-9+/=]+)\s*$")
+END = re.compile(r"TRACE END\s*$")
+
+# Mirrors TraceRecord of trace.h: sequence, slot, target, x, y, speed, resolution
+RECORD = struct.Struct("<HBBhhhH")
+FIELDS = ["sequence", "slot", "target", "x", "y", "speed", "resolution"]
+
+
+def parse(lines):
+    """Extract the records of the last complete trace dump from log lines."""
+    result = None
+    current = None
+    for line in lines:
+        if match := HEADER.search(line):
+            count, size = (int(value) for value in match.groups())
+            if size != RECORD.size:
+                sys.exit(f"Unsupported record size {size}, expected {RECORD.size}.")
+            current = {"count": count, "data": bytearray()}
+        elif current is not None and (match := CHUNK.search(line)):
+            offset = int(match.group(1), 16)
+            if offset != len(current["data"]):
+                # Lost log lines, discard the incomplete dump
+                current = None
+                continue
+            current["data"] += base64.b64decode(match.group(2))
+        elif current is not None and END.search(line):
+            if len(current["data"]) == current["count"] * RECORD.size:
+                result = current
+            current = None
+
+    if result is None:
+        return None
+    return [dict(zip(FIELDS, values)) for values in RECORD.iter_unpack(result["data"])]
+
+
+def print_records(records):
+    """Print the records as a table."""
+    print("   seq  slot  target       x       y   speed    res")
+    for record in records:
+        if record["resolution"] == 0:
+            print(
+                f"{record['sequence']:6}  {record['slot']:4}  Target {record['target'] + 1}   (empty)"
+            )
+            continue
+        print(
+            f"{record['sequence']:6}  {record['slot']:4}  Target {record['target'] + 1}"
+            f"  {record['x']:6}  {record['y']:6}  {record['speed']:6}  {record['resolution']:5}"
+        )
+
+
+def main():
+    """Entry point."""
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument(
+        "log", nargs="?", type=argparse.FileType("r"), default=sys.stdin
+    )
+    parser.add_argument("--csv", help="store the records in a CSV file")
+    args = parser.parse_args()
+
+    records = parse(args.log)
+    if records is None:
+        sys.exit("No complete trace dump found.")
+
+    if args.csv:
+        with open(args.csv, "w", newline="", encoding="utf-8") as file:
+            writer = csv.DictWriter(file, fieldnames=FIELDS)
+            writer.writeheader()
+            writer.writerows(records)
+    else:
+        print_records(records)
+
+
+if __name__ == "__main__":
+    main()
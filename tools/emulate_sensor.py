@@ -0,0 +1,410 @@
+"""Emulate the command protocol of the LD2450 sensor and measure data stream interruptions.
+
+Usage:
+    python3 tools/emulate_sensor.py
+    python3 tools/emulate_sensor.py --ack-loss 0.2 --restart-time 2500
+    python3 tools/emulate_sensor.py --port /dev/ttyUSB0 --baud 256000
+
+This tool is a protocol reference, not a test of the component. Without
+--port, the emulator is driven by a simplified model of the command queue of
+the hub (retries, acknowledgements, injected ENTER/LEAVE_CONFIG commands and
+the post restart lockout) in virtual time, to estimate how long each user
+action interrupts the data stream. Timing constants are read from
+components/LD2450/LD2450.h, but the model does not execute the C++ code and may
+diverge from it. The command handling of the component itself is tested by the
+host tests (make -C tests/host test), which drive the real hub through a fake
+UART.
+
+With --port, the emulator replaces the sensor of a real device (requires
+pyserial): it streams random-walk targets, answers commands and logs the
+interruption of each config session.
+
+The emulated sensor stops streaming in config mode, ignores commands other than
+ENTER_CONFIG outside of config mode and resumes streaming --restart-time ms
+after a restart. Acknowledgements can be dropped (--ack-loss) and streaming can
+stall (--stall-after, --stall-time) to exercise the recovery path.
+"""
+
+import argparse
+import os
+import random
+import re
+import struct
+import sys
+import time
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+
+from generate_frames import (  # noqa: E402  pylint: disable=wrong-import-position
+    FRAME_SIZE,
+    RandomWalkPerson,
+    Simulation,
+)
+
+COMPONENT_PATH = os.path.join(
+    os.path.dirname(os.path.abspath(__file__)), "..", "components", "LD2450"
+)
+HEADER_PATHS = [
+    os.path.join(COMPONENT_PATH, "LD2450.h"),
+    os.path.join(COMPONENT_PATH, "command_queue.h"),
+]
+CONFIG_HEADER = bytes([0xFD, 0xFC, 0xFB, 0xFA])
+CONFIG_TAIL = bytes([0x04, 0x03, 0x02, 0x01])
+FRAME_INTERVAL = 100
+BITS_PER_BYTE = 10
+FIRMWARE = bytes([0x00, 0x01, 0x02, 0x16, 0x24, 0x06, 0x22, 0x01])
+MAC = bytes([0x8F, 0x27, 0x2E, 0xB8, 0x0F, 0x65])
+NO_MAC = bytes([0x08, 0x05, 0x04, 0x03, 0x02, 0x01])
+
+
+def read_defines(paths=HEADER_PATHS):
+    """Read numeric #define constants of the hub headers."""
+    defines = {}
+    for path in paths:
+        with open(path, encoding="utf-8") as file:
+            for line in file:
+                if match := re.match(r"#define (\w+) (0x[0-9A-Fa-f]+|\d+)\s*$", line):
+                    defines[match.group(1)] = int(match.group(2), 0)
+    return defines
+
+
+DEFINES = read_defines()
+ENTER_CONFIG = DEFINES["COMMAND_ENTER_CONFIG"]
+LEAVE_CONFIG = DEFINES["COMMAND_LEAVE_CONFIG"]
+RESTART = DEFINES["COMMAND_RESTART"]
+FACTORY_RESET = DEFINES["COMMAND_FACTORY_RESET"]
+READ_VERSION = DEFINES["COMMAND_READ_VERSION"]
+READ_TRACKING_MODE = DEFINES["COMMAND_READ_TRACKING_MODE"]
+SINGLE_TRACKING_MODE = DEFINES["COMMAND_SINGLE_TRACKING_MODE"]
+MULTI_TRACKING_MODE = DEFINES["COMMAND_MULTI_TRACKING_MODE"]
+READ_MAC = DEFINES["COMMAND_READ_MAC"]
+BLUETOOTH = DEFINES["COMMAND_BLUETOOTH"]
+SET_BAUD_RATE = DEFINES["COMMAND_SET_BAUD_RATE"]
+
+# Command sequences queued by the user actions of LD2450.cpp
+READ_SWITCH_STATES = [[READ_TRACKING_MODE, 0x00], [READ_MAC, 0x00, 0x01, 0x00]]
+RESTART_SEQUENCE = [[RESTART, 0x00]] + READ_SWITCH_STATES
+ACTIONS = {
+    "startup": READ_SWITCH_STATES + [[READ_VERSION, 0x00]],
+    "restart": RESTART_SEQUENCE,
+    "factory_reset": [[FACTORY_RESET, 0x00]] + RESTART_SEQUENCE,
+    "tracking_mode": [[MULTI_TRACKING_MODE, 0x00], [READ_TRACKING_MODE, 0x00]],
+    "bluetooth": [[BLUETOOTH, 0x00, 0x01, 0x00]] + RESTART_SEQUENCE,
+    "baud_rate": [[SET_BAUD_RATE, 0x00, 0x07, 0x00]] + RESTART_SEQUENCE,
+    "config_recovery": [],
+}
+
+
+def encode_command(content):
+    """Encode a config frame as written by LD2450::write_command()."""
+    return (
+        CONFIG_HEADER + struct.pack("<H", len(content)) + bytes(content) + CONFIG_TAIL
+    )
+
+
+class SensorEmulator:
+    """Command protocol and streaming behaviour of the sensor."""
+
+    def __init__(self, args, rng):
+        self.args = args
+        self.rng = rng
+        self.config_mode = False
+        self.multi_tracking = True
+        self.bluetooth = True
+        self.restarting_until = None
+        self.next_frame = 0
+        self.buffer = bytearray()
+        self.responses = []
+        self.simulation = Simulation(
+            [RandomWalkPerson(rng, 20, 5) for _ in range(3)], 10, rng, 0, 0
+        )
+
+    def transfer_time(self, size):
+        """Get the time in ms to transfer a number of bytes."""
+        return size * BITS_PER_BYTE * 1000 / self.args.baud
+
+    def receive(self, data, now):
+        """Process bytes written by the hub."""
+        self.buffer += data
+        while (start := self.buffer.find(CONFIG_HEADER)) >= 0:
+            del self.buffer[:start]
+            if len(self.buffer) < 6:
+                return
+            length = struct.unpack_from("<H", self.buffer, 4)[0]
+            end = 6 + length + len(CONFIG_TAIL)
+            if len(self.buffer) < end:
+                return
+            content = bytes(self.buffer[6 : 6 + length])
+            valid = self.buffer[6 + length : end] == CONFIG_TAIL
+            del self.buffer[:end]
+            if valid:
+                self.handle_command(content, now)
+
+    def handle_command(self, content, now):
+        """Apply a command and schedule its acknowledgement."""
+        command = content[0]
+        if self.restarting_until is not None or (
+            not self.config_mode and command != ENTER_CONFIG
+        ):
+            return
+
+        data = b""
+        if command == ENTER_CONFIG:
+            self.config_mode = True
+            data = bytes([0x01, 0x00, 0x40, 0x00])
+        elif command == LEAVE_CONFIG:
+            self.config_mode = False
+            self.next_frame = max(self.next_frame, now + FRAME_INTERVAL)
+        elif command == READ_VERSION:
+            data = FIRMWARE
+        elif command == READ_TRACKING_MODE:
+            data = bytes([0x02 if self.multi_tracking else 0x01, 0x00])
+        elif command in (SINGLE_TRACKING_MODE, MULTI_TRACKING_MODE):
+            self.multi_tracking = command == MULTI_TRACKING_MODE
+        elif command == READ_MAC:
+            data = MAC if self.bluetooth else NO_MAC
+        elif command == BLUETOOTH:
+            self.bluetooth = content[2] == 0x01
+
+        ack = encode_command(bytes([command, 0x01, 0x00, 0x00]) + data)
+        if self.rng.random() >= self.args.ack_loss:
+            due = now + self.args.response_time + self.transfer_time(len(ack))
+            self.responses.append((due, ack))
+
+        if command == FACTORY_RESET:
+            self.multi_tracking = True
+            self.bluetooth = True
+        if command in (RESTART, FACTORY_RESET):
+            self.config_mode = False
+            self.restarting_until = now + self.args.restart_time
+
+    def poll(self, now):
+        """Get all frames which are completely transmitted at the given time."""
+        frames = [frame for due, frame in self.responses if due <= now]
+        self.responses = [(due, frame) for due, frame in self.responses if due > now]
+
+        if self.restarting_until is not None and now >= self.restarting_until:
+            self.restarting_until = None
+            self.next_frame = now + FRAME_INTERVAL
+        stalled = (
+            self.args.stall_after is not None
+            and self.args.stall_after
+            <= now
+            < self.args.stall_after + self.args.stall_time
+        )
+        streaming = not self.config_mode and self.restarting_until is None
+        if now >= self.next_frame:
+            self.next_frame += FRAME_INTERVAL
+            frame = self.simulation.next_frame()
+            if streaming and not stalled:
+                frames.append(frame)
+        return frames
+
+
+class HubModel:
+    """Simplified reference model of the command queue handling of LD2450::loop() and LD2450::process_config_message().
+
+    Only used for estimating stream interruptions, see tests/host for tests of the real implementation.
+    """
+
+    def __init__(self):
+        self.queue = []
+        self.configuration_mode = False
+        self.retries = 0
+        self.last_sent = -1e9
+        self.applying_changes = False
+        self.lockout_start = 0
+        self.writes = 0
+        self.sensor_available = False
+        self.last_message_received = 0
+        self.last_config_leave_attempt = 0
+
+    def send(self, commands):
+        """Queue the commands of an action, mirroring LD2450::send_config_messages()."""
+        # Actions are queued as a unit, one slot is reserved for the injected enter config command
+        if len(self.queue) + len(commands) + 1 <= DEFINES["COMMAND_QUEUE_SIZE"]:
+            self.queue.extend(list(command) for command in commands)
+
+    def loop(self, now):
+        """Run the command part of one loop iteration and get the bytes written to the sensor."""
+        if now - self.last_message_received > DEFINES["SENSOR_UNAVAILABLE_TIMEOUT"]:
+            self.sensor_available = False
+
+        # Recovery path: assume the sensor is stuck in config mode and attempt to leave it
+        if (
+            not self.applying_changes
+            and not self.sensor_available
+            and now - self.last_config_leave_attempt
+            > DEFINES["CONFIG_RECOVERY_INTERVAL"]
+        ):
+            self.last_config_leave_attempt = now
+            self.retries = 0
+            self.configuration_mode = True
+            self.queue = [[LEAVE_CONFIG, 0x00]]
+
+        if (
+            self.applying_changes
+            and now - self.lockout_start <= DEFINES["POST_RESTART_LOCKOUT_DELAY"]
+        ):
+            return b""
+        self.applying_changes = False
+
+        if not self.queue:
+            if self.configuration_mode:
+                self.queue.append([LEAVE_CONFIG, 0x00])
+                self.retries = 0
+            return b""
+
+        if not self.configuration_mode and self.queue[0][0] != ENTER_CONFIG:
+            self.queue.insert(0, [ENTER_CONFIG, 0x00, 0x01, 0x00])
+        if now - self.last_sent <= DEFINES["COMMAND_RETRY_DELAY"]:
+            return b""
+
+        if self.retries >= DEFINES["COMMAND_MAX_RETRIES"]:
+            if self.queue[0][0] == LEAVE_CONFIG:
+                self.configuration_mode = False
+                self.queue.pop(0)
+            elif self.queue[0][0] == ENTER_CONFIG:
+                self.queue.clear()
+            else:
+                self.queue.pop(0)
+            self.retries = 0
+            return b""
+
+        self.last_sent = now
+        self.retries += 1
+        self.writes += 1
+        return encode_command(self.queue[0])
+
+    def apply_frame(self, frame, now):
+        """Apply a frame received from the sensor."""
+        if len(frame) == FRAME_SIZE and frame[0] == 0xAA:
+            self.sensor_available = True
+            self.last_message_received = now
+            self.configuration_mode = False
+            return
+        content = frame[6:-4]
+        if self.queue and self.queue[0][0] == content[0] and content[1] == 0x01:
+            self.queue.pop(0)
+            self.retries = 0
+            self.last_sent = 0
+        if content[0] == ENTER_CONFIG:
+            self.configuration_mode = True
+        if content[0] == LEAVE_CONFIG:
+            self.configuration_mode = False
+        if content[0] in (FACTORY_RESET, RESTART):
+            self.configuration_mode = False
+            self.applying_changes = True
+            self.lockout_start = now
+
+
+def simulate_action(name, args, seed):
+    """Run a user action against the emulator and measure the data stream interruption in ms."""
+    rng = random.Random(seed)
+    sensor = SensorEmulator(args, rng)
+    hub = HubModel()
+    start = 1000
+    if name == "config_recovery":
+        # The sensor was left in config mode, e.g. by a reboot of the device during a config session
+        sensor.config_mode = True
+    last_data = 0
+    interruption = 0
+    now = 0
+    while now < start + args.timeout:
+        if now == start:
+            hub.send(ACTIONS[name])
+        for frame in sensor.poll(now):
+            if frame[0] == 0xAA:
+                if now > start and now - last_data > FRAME_INTERVAL * 1.5:
+                    interruption += now - last_data - FRAME_INTERVAL
+                last_data = now
+            hub.apply_frame(frame, now)
+        if now % args.loop_interval == 0:
+            sensor.receive(hub.loop(now), now)
+
+        # Done once all commands were processed and the stream has resumed
+        idle = not hub.queue and not hub.configuration_mode
+        if now > start and idle and hub.sensor_available and last_data == now:
+            return {"interruption": interruption, "writes": hub.writes, "done": True}
+        now += 1
+    return {"interruption": interruption, "writes": hub.writes, "done": False}
+
+
+def simulate(args):
+    """Print the data stream interruption of each user action."""
+    print(
+        f"{'action':<16} {'interruption':>12} {'commands':>9} {'writes':>7} {'completed':>10}"
+    )
+    for name in ACTIONS:
+        results = [simulate_action(name, args, seed) for seed in range(args.runs)]
+        interruption = sum(result["interruption"] for result in results) / len(results)
+        writes = sum(result["writes"] for result in results) / len(results)
+        done = sum(result["done"] for result in results)
+        print(
+            f"{name:<16} {interruption:>10.0f}ms {len(ACTIONS[name]):>9} {writes:>7.1f} {done:>6}/{len(results)}"
+        )
+
+
+def serve(args):
+    """Replace the sensor of a real device and log the interruption of each config session."""
+    import serial  # pylint: disable=import-outside-toplevel
+
+    port = serial.Serial(args.port, args.baud, timeout=0)
+    sensor = SensorEmulator(args, random.Random())
+    start = time.monotonic()
+    last_data = None
+    interrupted = False
+    while True:
+        now = (time.monotonic() - start) * 1000
+        sensor.receive(port.read(256), now)
+        if sensor.config_mode or sensor.restarting_until is not None:
+            interrupted = True
+        for frame in sensor.poll(now):
+            port.write(frame)
+            if frame[0] == 0xAA:
+                if interrupted and last_data is not None:
+                    print(f"Data stream interrupted for {now - last_data:.0f}ms")
+                interrupted = False
+                last_data = now
+        time.sleep(0.001)
+
+
+def main():
+    """Entry point."""
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--port", help="serial port connected to the device")
+    parser.add_argument("--baud", type=int, default=256000)
+    parser.add_argument(
+        "--restart-time", type=int, default=1200, help="restart duration (ms)"
+    )
+    parser.add_argument(
+        "--response-time", type=int, default=10, help="command response time (ms)"
+    )
+    parser.add_argument(
+        "--ack-loss", type=float, default=0, help="probability of a dropped ack"
+    )
+    parser.add_argument(
+        "--stall-after", type=int, help="stall streaming after this time (ms)"
+    )
+    parser.add_argument(
+        "--stall-time", type=int, default=5000, help="stall duration (ms)"
+    )
+    parser.add_argument(
+        "--loop-interval", type=int, default=16, help="hub loop interval (ms)"
+    )
+    parser.add_argument(
+        "--timeout", type=int, default=90000, help="maximum time per action (ms)"
+    )
+    parser.add_argument(
+        "--runs", type=int, default=20, help="simulation runs per action"
+    )
+    args = parser.parse_args()
+
+    if args.port:
+        serve(args)
+    else:
+        simulate(args)
+
+
+if __name__ == "__main__":
+    main()
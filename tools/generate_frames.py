@@ -0,0 +1,292 @@
+"""Generate LD2450 data frames for simulated people, as a stand-in for the sensor.
+
+Usage:
+    python3 tools/generate_frames.py --people 3 --duration 60 --output frames.bin
+    python3 tools/generate_frames.py --scenario walk.json --print
+    python3 tools/generate_frames.py --people 3 --speedup 100 --port /dev/ttyUSB0 --baud 460800
+
+People either follow scripted waypoints (--scenario) or random walks (--people).
+Slot swaps and dropouts can be injected to exercise target association,
+prediction and zone timeouts. Frames are written to a file, stdout or a serial
+port (requires pyserial), which can be connected to the RX pin of the device.
+With --speedup the simulated time advances faster than the wall clock, e.g.
+--speedup 100 sends 1000 frames per second for the default rate of 10 Hz.
+Combine high rates with the latency monitor of the hub to measure the CPU time
+per frame under load.
+
+A scenario is a JSON file with waypoints (time in s, x and y in mm) per person,
+a person is present between its first and last waypoint:
+    {"people": [{"waypoints": [[0, -2500, 1500], [4, 0, 2000], [8, 2500, 1500]]}]}
+"""
+
+import argparse
+import json
+import math
+import random
+import struct
+import sys
+import time
+
+HEADER = bytes([0xAA, 0xFF, 0x03, 0x00])
+TAIL = bytes([0x55, 0xCC])
+FRAME_SIZE = len(HEADER) + 24 + len(TAIL)
+SLOTS = 3
+MAX_DISTANCE = 6000
+MAX_ANGLE = 60
+BITS_PER_BYTE = 10
+
+
+def encode_signed(value):
+    """Encode a value with the sign bit used by the sensor for x and speed."""
+    value = max(-0x7FFF, min(0x7FFF, int(round(value))))
+    return value if value >= 0 else 0x8000 - value
+
+
+def encode_target(target):
+    """Encode a single target slot (x, y in mm, speed in cm/s, resolution in mm), None for an empty slot."""
+    if target is None:
+        return bytes(8)
+    x, y, speed, resolution = target
+    y = max(1, min(0x7FFF, int(round(y))))
+    return struct.pack(
+        "<HHHH", encode_signed(x), y + 0x8000, encode_signed(speed), int(resolution)
+    )
+
+
+def encode_frame(targets):
+    """Encode a data frame from up to three target slots."""
+    return HEADER + b"".join(encode_target(target) for target in targets) + TAIL
+
+
+def decode_signed(raw):
+    """Decode a value encoded by encode_signed, mirroring LD2450::decode_targets()."""
+    return -(raw - 0x8000) if raw & 0x8000 else raw
+
+
+def decode_frame(frame):
+    """Decode a data frame into three slots of (x, y, speed, resolution), None for empty slots."""
+    if len(frame) != FRAME_SIZE or frame[:4] != HEADER or frame[-2:] != TAIL:
+        raise ValueError("invalid frame")
+    targets = []
+    for offset in range(4, 28, 8):
+        x, y, speed, resolution = struct.unpack_from("<HHHH", frame, offset)
+        if resolution == 0:
+            targets.append(None)
+            continue
+        targets.append(
+            (decode_signed(x), y - 0x8000 if y else 0, decode_signed(speed), resolution)
+        )
+    return targets
+
+
+def in_field_of_view(x, y):
+    """Determine whether a position is visible to the sensor."""
+    return 0 < y <= MAX_DISTANCE and abs(math.degrees(math.atan2(x, y))) <= MAX_ANGLE
+
+
+class ScriptedPerson:
+    """Person which moves linearly between waypoints."""
+
+    def __init__(self, waypoints):
+        self.waypoints = sorted((float(t), float(x), float(y)) for t, x, y in waypoints)
+
+    def position(self, now):
+        """Get the position at the given time, None if not present."""
+        if not self.waypoints or not (
+            self.waypoints[0][0] <= now <= self.waypoints[-1][0]
+        ):
+            return None
+        for (t0, x0, y0), (t1, x1, y1) in zip(self.waypoints, self.waypoints[1:]):
+            if t0 <= now <= t1:
+                ratio = (now - t0) / (t1 - t0) if t1 > t0 else 0
+                return x0 + (x1 - x0) * ratio, y0 + (y1 - y0) * ratio
+        return self.waypoints[-1][1:]
+
+
+class RandomWalkPerson:
+    """Person which enters the field of view, wanders around and leaves again."""
+
+    def __init__(self, rng, dwell, absence):
+        self.rng = rng
+        self.dwell = dwell
+        self.absence = absence
+        self.present = False
+        self.next_change = rng.expovariate(1 / absence)
+        self.x = self.y = self.heading = self.speed = 0.0
+
+    def step(self, now, dt):
+        """Advance the walk and get the position, None if not present."""
+        if not self.present and now >= self.next_change:
+            # Enter from the edge of the field of view, walking inwards
+            self.present = True
+            self.next_change = now + self.rng.expovariate(1 / self.dwell)
+            angle = math.radians(self.rng.uniform(-MAX_ANGLE, MAX_ANGLE))
+            distance = self.rng.uniform(2000, MAX_DISTANCE - 200)
+            self.x, self.y = distance * math.sin(angle), distance * math.cos(angle)
+            self.heading = math.atan2(-self.x, -self.y) + self.rng.gauss(0, 0.5)
+            self.speed = self.rng.uniform(300, 1200)
+        elif self.present and now >= self.next_change:
+            self.present = False
+            self.next_change = now + self.rng.expovariate(1 / self.absence)
+        if not self.present:
+            return None
+
+        self.heading += self.rng.gauss(0, 0.4) * math.sqrt(dt)
+        x = self.x + math.sin(self.heading) * self.speed * dt
+        y = self.y + math.cos(self.heading) * self.speed * dt
+        if not in_field_of_view(x, y):
+            # Turn back at the boundary, such that targets cross zone margins repeatedly
+            self.heading += math.pi
+            x, y = self.x, self.y
+        self.x, self.y = x, y
+        return x, y
+
+
+class Simulation:
+    """Maps people to the three report slots and injects sensor artifacts."""
+
+    def __init__(self, people, rate, rng, swap_probability, dropout_probability):
+        self.people = people
+        self.dt = 1 / rate
+        self.rng = rng
+        self.swap_probability = swap_probability
+        self.dropout_probability = dropout_probability
+        self.slots = [None] * SLOTS
+        self.previous = {}
+        self.now = 0.0
+
+    def positions(self):
+        """Get the positions of all people at the current time."""
+        result = {}
+        for index, person in enumerate(self.people):
+            if isinstance(person, RandomWalkPerson):
+                position = person.step(self.now, self.dt)
+            else:
+                position = person.position(self.now)
+            if position is not None and in_field_of_view(*position):
+                result[index] = position
+        return result
+
+    def next_frame(self):
+        """Advance the simulation by one frame and get the encoded frame."""
+        positions = self.positions()
+
+        # People keep their slot while present, new people take the first free slot
+        self.slots = [slot if slot in positions else None for slot in self.slots]
+        for index in positions:
+            if index not in self.slots and None in self.slots:
+                self.slots[self.slots.index(None)] = index
+        if self.rng.random() < self.swap_probability:
+            first, second = self.rng.sample(range(SLOTS), 2)
+            self.slots[first], self.slots[second] = (
+                self.slots[second],
+                self.slots[first],
+            )
+
+        targets = []
+        for index in self.slots:
+            if index is None or self.rng.random() < self.dropout_probability:
+                targets.append(None)
+                continue
+            x, y = positions[index]
+            distance = math.hypot(x, y)
+            previous = self.previous.get(index)
+            speed = (distance - previous) / self.dt / 10 if previous is not None else 0
+            targets.append((x, y, speed, 360))
+
+        self.previous = {
+            index: math.hypot(*position) for index, position in positions.items()
+        }
+        self.now += self.dt
+        return encode_frame(targets)
+
+
+def load_scenario(path):
+    """Load scripted people from a scenario file."""
+    with open(path, encoding="utf-8") as file:
+        scenario = json.load(file)
+    return [ScriptedPerson(person["waypoints"]) for person in scenario["people"]]
+
+
+def open_output(args):
+    """Open the frame sink selected by the arguments."""
+    if args.port:
+        import serial  # pylint: disable=import-outside-toplevel
+
+        return serial.Serial(args.port, args.baud)
+    if args.output:
+        return open(args.output, "wb")
+    return sys.stdout.buffer
+
+
+def main():
+    """Entry point."""
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--scenario", help="JSON file with scripted people")
+    parser.add_argument(
+        "--people", type=int, default=1, help="number of random-walk people"
+    )
+    parser.add_argument("--dwell", type=float, default=20, help="mean dwell time (s)")
+    parser.add_argument(
+        "--absence", type=float, default=5, help="mean absence time (s)"
+    )
+    parser.add_argument(
+        "--rate", type=float, default=10, help="frames per simulated second"
+    )
+    parser.add_argument(
+        "--duration", type=float, default=60, help="simulated duration (s)"
+    )
+    parser.add_argument(
+        "--speedup",
+        type=float,
+        default=1,
+        help="simulated seconds per wall clock second, 0 to send without pacing",
+    )
+    parser.add_argument("--swap-probability", type=float, default=0)
+    parser.add_argument("--dropout-probability", type=float, default=0)
+    parser.add_argument("--seed", type=int, help="random seed for reproducible runs")
+    parser.add_argument("--output", "-o", help="store frames in a binary file")
+    parser.add_argument("--port", help="send frames to a serial port")
+    parser.add_argument("--baud", type=int, default=256000)
+    parser.add_argument(
+        "--print", action="store_true", help="print decoded frames instead"
+    )
+    args = parser.parse_args()
+
+    rng = random.Random(args.seed)
+    if args.scenario:
+        people = load_scenario(args.scenario)
+    else:
+        people = [
+            RandomWalkPerson(rng, args.dwell, args.absence) for _ in range(args.people)
+        ]
+    simulation = Simulation(
+        people, args.rate, rng, args.swap_probability, args.dropout_probability
+    )
+
+    frame_rate = args.rate * args.speedup
+    if args.port and frame_rate * FRAME_SIZE * BITS_PER_BYTE > args.baud:
+        print(
+            f"Warning: {frame_rate:.0f} frames/s exceed the capacity of {args.baud} baud.",
+            file=sys.stderr,
+        )
+
+    output = None if args.print else open_output(args)
+    start = time.monotonic()
+    for number in range(int(args.duration * args.rate)):
+        frame = simulation.next_frame()
+        if args.print:
+            print(f"{simulation.now - simulation.dt:8.2f}s {decode_frame(frame)}")
+            continue
+        output.write(frame)
+        if args.speedup > 0:
+            delay = start + (number + 1) / frame_rate - time.monotonic()
+            if delay > 0:
+                output.flush()
+                time.sleep(delay)
+    if output is not None:
+        output.flush()
+
+
+if __name__ == "__main__":
+    main()
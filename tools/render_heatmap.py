@@ -0,0 +1,122 @@
+"""Render a heatmap which was dumped by the LD2450.heatmap.dump action.
+
+Usage:
+    python3 tools/render_heatmap.py device.log
+    esphome logs device.yaml | python3 tools/render_heatmap.py
+    python3 tools/render_heatmap.py device.log --output heatmap.png
+
+The last complete dump within the log is used. Without --output the heatmap is
+printed to the terminal, with the lowest y coordinates at the bottom (by default
+the sensor is located at the bottom center).
+PNG output requires matplotlib.
+"""
+
+import argparse
+import base64
+import re
+import struct
+import sys
+
+# Columns, rows, cell size and the origin (x_min, y_min), which is missing in dumps of older versions
+HEADER = re.compile(r"HEATMAP (\d+) (\d+) (\d+)(?: (-?\d+) (-?\d+))?\s*$")
+CHUNK = re.compile(r"HEATMAP ([0-9A-F]{4}) ([A-Za-z0-9+/=]+)\s*$")
+END = re.compile(r"HEATMAP END\s*$")
+SHADES = " .:-=+*#%@"
+
+
+def parse(lines):
+    """Extract the last complete heatmap dump from log lines."""
+    result = None
+    current = None
+    for line in lines:
+        if match := HEADER.search(line):
+            columns, rows, cell_size, x_min, y_min = match.groups()
+            columns, rows, cell_size = int(columns), int(rows), int(cell_size)
+            current = {
+                "columns": columns,
+                "rows": rows,
+                "cell_size": cell_size,
+                "x_min": int(x_min) if x_min else -columns * cell_size // 2,
+                "y_min": int(y_min) if y_min else 0,
+                "data": bytearray(),
+            }
+        elif current is not None and (match := CHUNK.search(line)):
+            offset = int(match.group(1), 16)
+            if offset != len(current["data"]):
+                # Lost log lines, discard the incomplete dump
+                current = None
+                continue
+            current["data"] += base64.b64decode(match.group(2))
+        elif current is not None and END.search(line):
+            if len(current["data"]) == current["columns"] * current["rows"] * 2:
+                result = current
+            current = None
+
+    if result is None:
+        return None
+
+    cells = struct.unpack(f"<{result['columns'] * result['rows']}H", result["data"])
+    result["grid"] = [
+        cells[row * result["columns"] : (row + 1) * result["columns"]]
+        for row in range(result["rows"])
+    ]
+    return result
+
+
+def render_text(heatmap):
+    """Print the heatmap using ASCII shades, furthest row first."""
+    maximum = max(max(row) for row in heatmap["grid"]) or 1
+    for row in reversed(heatmap["grid"]):
+        print(
+            "".join(
+                SHADES[min(len(SHADES) - 1, value * len(SHADES) // (maximum + 1))] * 2
+                for value in row
+            )
+        )
+    print(
+        f"{heatmap['columns']} x {heatmap['rows']} cells of {heatmap['cell_size']} mm, maximum {maximum} frames"
+    )
+
+
+def render_image(heatmap, output):
+    """Store the heatmap as an image in sensor or room coordinates (m)."""
+    import matplotlib.pyplot as plt  # pylint: disable=import-outside-toplevel
+
+    x_min = heatmap["x_min"] / 1000
+    y_min = heatmap["y_min"] / 1000
+    width = heatmap["columns"] * heatmap["cell_size"] / 1000
+    depth = heatmap["rows"] * heatmap["cell_size"] / 1000
+    fig, ax = plt.subplots()
+    image = ax.imshow(
+        heatmap["grid"],
+        origin="lower",
+        extent=(x_min, x_min + width, y_min, y_min + depth),
+        cmap="inferno",
+    )
+    ax.set_xlabel("x (m)")
+    ax.set_ylabel("y (m)")
+    fig.colorbar(image, label="frames")
+    fig.savefig(output, dpi=150)
+
+
+def main():
+    """Entry point."""
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument(
+        "log", nargs="?", type=argparse.FileType("r"), default=sys.stdin
+    )
+    parser.add_argument("--output", "-o", help="store the heatmap as an image")
+    args = parser.parse_args()
+
+    heatmap = parse(args.log)
+    if heatmap is None:
+        sys.exit("No complete heatmap dump found.")
+
+    if args.output:
+        render_image(heatmap, args.output)
+    else:
+        render_text(heatmap)
+
+
+if __name__ == "__main__":
+    main()